@@ -1,10 +1,12 @@
 import 'dart:async';
+import 'dart:typed_data';
 
 import 'package:flutter/foundation.dart';
 import 'package:flutter/services.dart';
 
 import 'exceptions.dart';
 import 'models/models.dart';
+import 'native/native_bindings.dart';
 import 'platform_interface.dart';
 
 /// Enhanced device information with detailed hardware specs and capabilities.
@@ -27,6 +29,9 @@ class FlutterDeviceInfoPlus {
   static const MethodChannel _channel = MethodChannel(
     'flutter_device_info_plus',
   );
+  static const EventChannel _monitorChannel = EventChannel(
+    'flutter_device_info_plus/monitors',
+  );
 
   /// Gets comprehensive device information including hardware specs,
   /// system details, and capabilities.
@@ -188,6 +193,295 @@ class FlutterDeviceInfoPlus {
     }
   }
 
+  /// Gets every monitor attached to the device.
+  ///
+  /// The native side caches the list and only re-enumerates monitors after
+  /// a hotplug or configuration change, so repeated calls are cheap. Prefer
+  /// [watchMonitors] to react to changes.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms and
+  /// [DeviceInfoException] if the monitors cannot be retrieved.
+  Future<List<MonitorInfo>> getMonitors() async {
+    _ensureLinux('monitors');
+    try {
+      final data =
+          await _channel.invokeMethod('getMonitors') as List<dynamic>? ?? [];
+      return _parseMonitors(data);
+    } catch (e) {
+      throw DeviceInfoException('Failed to get monitors: $e');
+    }
+  }
+
+  /// Emits the monitor list on subscription and again whenever a monitor is
+  /// added, removed or reconfigured.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms.
+  Stream<List<MonitorInfo>> watchMonitors() {
+    _ensureLinux('monitors');
+    return _monitorChannel.receiveBroadcastStream().map(
+      (final data) => _parseMonitors(data as List<dynamic>),
+    );
+  }
+
+  /// Gets the native instrumentation counters: time spent per collector,
+  /// cache hit rates and how much was read from procfs and sysfs since the
+  /// plugin was loaded.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms and
+  /// [DeviceInfoException] if the counters cannot be retrieved.
+  Future<PluginStats> getPluginStats() async {
+    _ensureLinux('pluginStats');
+    try {
+      final data =
+          await _channel.invokeMethod('getPluginStats')
+              as Map<dynamic, dynamic>;
+      return PluginStats.fromMap(data);
+    } catch (e) {
+      throw DeviceInfoException('Failed to get plugin stats: $e');
+    }
+  }
+
+  /// Sets how long the native side reuses the result of [getDeviceInfo],
+  /// [getBatteryInfo], [getSensorInfo] and [getNetworkInfo].
+  ///
+  /// Identical calls made while a collection is running always share its
+  /// result; within [window] after it finished they get the cached result
+  /// without collecting again. This keeps many widgets querying at startup
+  /// from each running every collector. Defaults to 250 ms; pass
+  /// [Duration.zero] to only share in-flight collections.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms and
+  /// [DeviceInfoException] if the window cannot be set.
+  Future<void> setFreshnessWindow(final Duration window) async {
+    _ensureLinux('freshnessWindow');
+    if (window.isNegative) {
+      throw ArgumentError.value(window, 'window', 'must not be negative');
+    }
+    try {
+      await _channel.invokeMethod<void>('setFreshnessWindow', {
+        'windowMs': window.inMilliseconds,
+      });
+    } catch (e) {
+      throw DeviceInfoException('Failed to set freshness window: $e');
+    }
+  }
+
+  /// Gets the NUMA nodes, the CPU affinity mask of this process and the
+  /// CPUs isolated from the scheduler.
+  ///
+  /// Use it to place compute isolates on CPUs of the node that holds their
+  /// memory; [ProcessorInfo.coreCount] alone can't tell sockets apart.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms and
+  /// [DeviceInfoException] if the topology cannot be retrieved.
+  Future<CpuTopology> getCpuTopology() async {
+    _ensureLinux('cpuTopology');
+    try {
+      final data =
+          await _channel.invokeMethod('getCpuTopology')
+              as Map<dynamic, dynamic>;
+      return CpuTopology.fromMap(data);
+    } catch (e) {
+      throw DeviceInfoException('Failed to get CPU topology: $e');
+    }
+  }
+
+  /// Gets the GPUs and display devices registered with the kernel's DRM
+  /// subsystem, ordered by card number.
+  ///
+  /// Returns an empty list on machines without a DRM device (e.g. headless
+  /// servers and most containers). The inventory is cached on the native
+  /// side; pass [refresh] to re-read it, e.g. after an eGPU was attached.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms and
+  /// [DeviceInfoException] if the devices cannot be retrieved.
+  Future<List<GpuInfo>> getGpus({final bool refresh = false}) async {
+    _ensureLinux('gpus');
+    try {
+      final data =
+          await _channel.invokeMethod('getGpus', {'refresh': refresh})
+              as List<dynamic>;
+      return data
+          .map((final g) => GpuInfo.fromMap(g as Map<dynamic, dynamic>))
+          .toList();
+    } catch (e) {
+      throw DeviceInfoException('Failed to get GPUs: $e');
+    }
+  }
+
+  /// Gets the CPU, memory and I/O limits that actually apply to this
+  /// process, taking container (cgroup v1 or v2) limits and CPU affinity
+  /// into account.
+  ///
+  /// Limits rarely change, so the native side caches them; pass [refresh]
+  /// to re-read them, e.g. after the container was resized.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms and
+  /// [DeviceInfoException] if the limits cannot be retrieved.
+  Future<ResourceLimits> getResourceLimits({final bool refresh = false}) async {
+    _ensureLinux('resourceLimits');
+    try {
+      final data =
+          await _channel.invokeMethod('getResourceLimits', {
+                'refresh': refresh,
+              })
+              as Map<dynamic, dynamic>;
+      return ResourceLimits.fromMap(data);
+    } catch (e) {
+      throw DeviceInfoException('Failed to get resource limits: $e');
+    }
+  }
+
+  /// Starts publishing [DeviceSample]s into a shared-memory ring.
+  ///
+  /// [interval] is how often memory is sampled. Slower-changing values
+  /// (battery, storage, network) use longer minimum intervals, every
+  /// collector backs off while its value is stable, and sampling pauses
+  /// while the app window is hidden or unfocused. Every wakeup publishes a
+  /// sample with the latest values and a fresh timestamp, so a stable system
+  /// can be told apart from a stalled sampler.
+  ///
+  /// Once started, any isolate can call [readLatestSample] synchronously and
+  /// other processes of the same user can map the ring by the returned name
+  /// (see `fdip_snapshot_ring.h`), so all of them share a single sampler.
+  /// The name is unique to this process and is removed again by
+  /// [stopSharedSampling] or when the process exits. Returns null if the
+  /// ring could only be created anonymously and is therefore visible to this
+  /// process only.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms and
+  /// [DeviceInfoException] if sampling cannot be started.
+  Future<String?> startSharedSampling({
+    final Duration interval = const Duration(seconds: 1),
+  }) async {
+    _ensureLinux('sharedSampling');
+    try {
+      final data =
+          await _channel.invokeMethod('startSharedSampling', {
+                'intervalMs': interval.inMilliseconds,
+              })
+              as Map<dynamic, dynamic>;
+      final ringName = data['ringName'] as String? ?? '';
+      return ringName.isEmpty ? null : ringName;
+    } catch (e) {
+      throw DeviceInfoException('Failed to start shared sampling: $e');
+    }
+  }
+
+  /// Stops the sampler started by [startSharedSampling] and removes the
+  /// ring's name, so other processes can no longer open it.
+  ///
+  /// The last published samples remain readable from this process.
+  Future<void> stopSharedSampling() async {
+    _ensureLinux('sharedSampling');
+    try {
+      await _channel.invokeMethod<void>('stopSharedSampling');
+    } catch (e) {
+      throw DeviceInfoException('Failed to stop shared sampling: $e');
+    }
+  }
+
+  /// Gets min/max/avg rollups of [metric] over the last [range] at
+  /// [resolution].
+  ///
+  /// The history is recorded natively by the shared sampler. Nothing is
+  /// recorded until [startSharedSampling] has been called, so before that
+  /// the result is empty; afterwards it is kept across [stopSharedSampling]
+  /// and hot restarts of the Dart VM. [range] is capped at
+  /// [HistoryResolution.retention].
+  ///
+  /// A metric is recorded each time the sampler reads it: CPU usage and
+  /// memory every sampling interval, battery every 5 s and storage every
+  /// 30 s, all less often while the value is stable and not at all while
+  /// sampling is paused. Buckets without a reading are left out.
+  ///
+  /// Only supported on Linux.
+  ///
+  /// Throws [UnsupportedFeatureException] on other platforms and
+  /// [DeviceInfoException] if the history cannot be retrieved.
+  Future<MetricHistory> getHistory(
+    final HistoryMetric metric, {
+    final Duration range = const Duration(minutes: 10),
+    final HistoryResolution resolution = HistoryResolution.oneSecond,
+  }) async {
+    _ensureLinux('history');
+    try {
+      final data = await _channel.invokeMethod<Float64List>('getHistory', {
+        'metric': metric.name,
+        'rangeMs': range.inMilliseconds,
+        'resolutionMs': resolution.bucket.inMilliseconds,
+      });
+      return MetricHistory(data ?? Float64List(0));
+    } catch (e) {
+      throw DeviceInfoException('Failed to get history: $e');
+    }
+  }
+
+  /// Synchronously reads the newest [DeviceSample] published by
+  /// [startSharedSampling] through `dart:ffi`, without a platform channel
+  /// round trip.
+  ///
+  /// Returns null if shared sampling was never started or isn't supported on
+  /// the current platform.
+  DeviceSample? readLatestSample() =>
+      NativeBindings.instance?.readLatestSample();
+
+  /// Synchronously returns the number of online processor cores.
+  ///
+  /// Uses a direct `dart:ffi` call instead of a platform channel, so it is
+  /// cheap enough for hot paths. Returns null on platforms without a native
+  /// fast path (currently everything except Linux).
+  int? getCoreCountSync() => NativeBindings.instance?.getCoreCount();
+
+  /// Synchronously returns the total physical RAM in bytes.
+  ///
+  /// See [getCoreCountSync] for platform support.
+  int? getTotalPhysicalMemorySync() =>
+      NativeBindings.instance?.getTotalPhysicalMemory();
+
+  /// Synchronously returns the available physical RAM in bytes.
+  ///
+  /// Useful to check memory headroom right before a large allocation. See
+  /// [getCoreCountSync] for platform support.
+  int? getAvailablePhysicalMemorySync() =>
+      NativeBindings.instance?.getAvailablePhysicalMemory();
+
+  /// Synchronously returns the CPU usage (0-100) across all cores since the
+  /// previous call from any isolate, or since boot for the first call.
+  ///
+  /// See [getCoreCountSync] for platform support.
+  double? getCpuUsagePercentageSync() =>
+      NativeBindings.instance?.getCpuUsagePercentage();
+
+  void _ensureLinux(final String feature) {
+    if (kIsWeb || defaultTargetPlatform != TargetPlatform.linux) {
+      throw UnsupportedFeatureException(
+        '$feature is only available on Linux',
+        feature: feature,
+      );
+    }
+  }
+
+  List<MonitorInfo> _parseMonitors(final List<dynamic> data) => data
+      .map((final m) => MonitorInfo.fromMap(m as Map<dynamic, dynamic>))
+      .toList();
+
   ProcessorInfo _parseProcessorInfo(final Map<dynamic, dynamic>? data) {
     if (data == null) {
       return const ProcessorInfo(
@@ -0,0 +1,161 @@
+import 'package:flutter/foundation.dart';
+
+/// A NUMA node: a group of CPUs sharing the same local memory.
+@immutable
+class NumaNode {
+  /// Creates a new [NumaNode] instance.
+  const NumaNode({
+    required this.id,
+    required this.cpus,
+    required this.totalMemory,
+    required this.freeMemory,
+    required this.distances,
+  });
+
+  /// Creates a [NumaNode] from a platform channel map.
+  factory NumaNode.fromMap(final Map<dynamic, dynamic> data) => NumaNode(
+    id: (data['id'] as num?)?.toInt() ?? 0,
+    cpus: _ints(data['cpus']),
+    totalMemory: (data['totalMemory'] as num?)?.toInt() ?? 0,
+    freeMemory: (data['freeMemory'] as num?)?.toInt() ?? 0,
+    distances: _ints(data['distances']),
+  );
+
+  /// Kernel node number.
+  final int id;
+
+  /// CPUs belonging to this node.
+  final List<int> cpus;
+
+  /// Memory attached to this node in bytes.
+  final int totalMemory;
+
+  /// Free memory on this node in bytes.
+  final int freeMemory;
+
+  /// Relative cost of accessing each node's memory from this node, in the
+  /// order of [CpuTopology.nodes]. 10 means local; 20 is twice as slow.
+  final List<int> distances;
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is NumaNode &&
+        other.id == id &&
+        listEquals(other.cpus, cpus) &&
+        other.totalMemory == totalMemory &&
+        other.freeMemory == freeMemory &&
+        listEquals(other.distances, distances);
+  }
+
+  @override
+  int get hashCode => Object.hash(
+    id,
+    Object.hashAll(cpus),
+    totalMemory,
+    freeMemory,
+    Object.hashAll(distances),
+  );
+
+  @override
+  String toString() =>
+      'NumaNode('
+      'id: $id, '
+      'cpus: $cpus, '
+      'totalMemory: $totalMemory, '
+      'freeMemory: $freeMemory, '
+      'distances: $distances'
+      ')';
+}
+
+/// CPU and memory topology used to place threads close to their memory.
+@immutable
+class CpuTopology {
+  /// Creates a new [CpuTopology] instance.
+  const CpuTopology({
+    required this.onlineCpus,
+    required this.allowedCpus,
+    required this.isolatedCpus,
+    required this.nodes,
+  });
+
+  /// Creates a [CpuTopology] from a platform channel map.
+  factory CpuTopology.fromMap(final Map<dynamic, dynamic> data) => CpuTopology(
+    onlineCpus: _ints(data['onlineCpus']),
+    allowedCpus: _ints(data['allowedCpus']),
+    isolatedCpus: _ints(data['isolatedCpus']),
+    nodes: List<NumaNode>.unmodifiable(
+      (data['nodes'] as List<dynamic>? ?? []).map(
+        (final n) => NumaNode.fromMap(n as Map<dynamic, dynamic>),
+      ),
+    ),
+  );
+
+  /// CPUs currently online.
+  final List<int> onlineCpus;
+
+  /// CPUs this process may run on (its affinity mask).
+  final List<int> allowedCpus;
+
+  /// CPUs excluded from general scheduling with the `isolcpus` kernel
+  /// parameter, typically reserved for pinned real-time work.
+  final List<int> isolatedCpus;
+
+  /// NUMA nodes. Machines without NUMA report a single node holding every
+  /// online CPU.
+  final List<NumaNode> nodes;
+
+  /// Whether memory access cost depends on which node a thread runs on.
+  bool get isNuma => nodes.length > 1;
+
+  /// The node that [cpu] belongs to, or null if it is unknown.
+  NumaNode? nodeOf(final int cpu) {
+    for (final node in nodes) {
+      if (node.cpus.contains(cpu)) {
+        return node;
+      }
+    }
+    return null;
+  }
+
+  /// The CPUs of [node] this process may run on.
+  List<int> allowedCpusOn(final NumaNode node) =>
+      node.cpus.where(allowedCpus.contains).toList();
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is CpuTopology &&
+        listEquals(other.onlineCpus, onlineCpus) &&
+        listEquals(other.allowedCpus, allowedCpus) &&
+        listEquals(other.isolatedCpus, isolatedCpus) &&
+        listEquals(other.nodes, nodes);
+  }
+
+  @override
+  int get hashCode => Object.hash(
+    Object.hashAll(onlineCpus),
+    Object.hashAll(allowedCpus),
+    Object.hashAll(isolatedCpus),
+    Object.hashAll(nodes),
+  );
+
+  @override
+  String toString() =>
+      'CpuTopology('
+      'onlineCpus: $onlineCpus, '
+      'allowedCpus: $allowedCpus, '
+      'isolatedCpus: $isolatedCpus, '
+      'nodes: $nodes'
+      ')';
+}
+
+List<int> _ints(final Object? value) => List<int>.unmodifiable(
+  (value as List<dynamic>? ?? []).map((final v) => (v as num).toInt()),
+);
@@ -0,0 +1,133 @@
+import 'package:flutter/foundation.dart';
+
+/// A compact sample of the frequently changing device metrics.
+///
+/// Samples are produced by the native shared sampler and can be read
+/// synchronously, without a platform channel round trip.
+@immutable
+class DeviceSample {
+  /// Creates a new [DeviceSample] instance.
+  const DeviceSample({
+    required this.sequence,
+    required this.timestamp,
+    required this.totalPhysicalMemory,
+    required this.availablePhysicalMemory,
+    required this.totalStorageSpace,
+    required this.availableStorageSpace,
+    required this.coreCount,
+    required this.maxFrequency,
+    required this.isConnected,
+    this.batteryLevel,
+  });
+
+  /// Monotonically increasing number of this sample, starting at 1.
+  final int sequence;
+
+  /// When the sample was taken.
+  final DateTime timestamp;
+
+  /// Total physical RAM in bytes.
+  final int totalPhysicalMemory;
+
+  /// Available physical RAM in bytes.
+  final int availablePhysicalMemory;
+
+  /// Total storage space in bytes.
+  final int totalStorageSpace;
+
+  /// Available storage space in bytes.
+  final int availableStorageSpace;
+
+  /// The number of CPU cores.
+  final int coreCount;
+
+  /// The frequency of the processor in MHz.
+  final int maxFrequency;
+
+  /// Whether the device is currently connected to a network.
+  final bool isConnected;
+
+  /// Battery level (0-100), or null if the device has no battery.
+  final int? batteryLevel;
+
+  /// Current memory usage as a percentage (0-100).
+  double get memoryUsagePercentage => totalPhysicalMemory > 0
+      ? (totalPhysicalMemory - availablePhysicalMemory) *
+            100 /
+            totalPhysicalMemory
+      : 0;
+
+  /// Creates a copy of this [DeviceSample] with the given fields replaced.
+  DeviceSample copyWith({
+    final int? sequence,
+    final DateTime? timestamp,
+    final int? totalPhysicalMemory,
+    final int? availablePhysicalMemory,
+    final int? totalStorageSpace,
+    final int? availableStorageSpace,
+    final int? coreCount,
+    final int? maxFrequency,
+    final bool? isConnected,
+    final int? batteryLevel,
+  }) => DeviceSample(
+    sequence: sequence ?? this.sequence,
+    timestamp: timestamp ?? this.timestamp,
+    totalPhysicalMemory: totalPhysicalMemory ?? this.totalPhysicalMemory,
+    availablePhysicalMemory:
+        availablePhysicalMemory ?? this.availablePhysicalMemory,
+    totalStorageSpace: totalStorageSpace ?? this.totalStorageSpace,
+    availableStorageSpace: availableStorageSpace ?? this.availableStorageSpace,
+    coreCount: coreCount ?? this.coreCount,
+    maxFrequency: maxFrequency ?? this.maxFrequency,
+    isConnected: isConnected ?? this.isConnected,
+    batteryLevel: batteryLevel ?? this.batteryLevel,
+  );
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is DeviceSample &&
+        other.sequence == sequence &&
+        other.timestamp == timestamp &&
+        other.totalPhysicalMemory == totalPhysicalMemory &&
+        other.availablePhysicalMemory == availablePhysicalMemory &&
+        other.totalStorageSpace == totalStorageSpace &&
+        other.availableStorageSpace == availableStorageSpace &&
+        other.coreCount == coreCount &&
+        other.maxFrequency == maxFrequency &&
+        other.isConnected == isConnected &&
+        other.batteryLevel == batteryLevel;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+    sequence,
+    timestamp,
+    totalPhysicalMemory,
+    availablePhysicalMemory,
+    totalStorageSpace,
+    availableStorageSpace,
+    coreCount,
+    maxFrequency,
+    isConnected,
+    batteryLevel,
+  );
+
+  @override
+  String toString() =>
+      'DeviceSample('
+      'sequence: $sequence, '
+      'timestamp: $timestamp, '
+      'totalPhysicalMemory: $totalPhysicalMemory, '
+      'availablePhysicalMemory: $availablePhysicalMemory, '
+      'totalStorageSpace: $totalStorageSpace, '
+      'availableStorageSpace: $availableStorageSpace, '
+      'coreCount: $coreCount, '
+      'maxFrequency: $maxFrequency, '
+      'isConnected: $isConnected, '
+      'batteryLevel: $batteryLevel'
+      ')';
+}
@@ -0,0 +1,115 @@
+import 'package:flutter/foundation.dart';
+
+/// A GPU or display device exposed by the kernel's DRM subsystem.
+@immutable
+class GpuInfo {
+  /// Creates a new [GpuInfo] instance.
+  const GpuInfo({
+    required this.card,
+    required this.driver,
+    required this.pciVendorId,
+    required this.pciDeviceId,
+    required this.pciSlot,
+    required this.isBootVga,
+    required this.vramTotal,
+    required this.currentClockMhz,
+    required this.maxClockMhz,
+    required this.renderNode,
+  });
+
+  /// Creates a [GpuInfo] from a platform channel map.
+  factory GpuInfo.fromMap(final Map<dynamic, dynamic> data) => GpuInfo(
+    card: data['card'] as String? ?? '',
+    driver: data['driver'] as String? ?? '',
+    pciVendorId: (data['pciVendorId'] as num?)?.toInt() ?? 0,
+    pciDeviceId: (data['pciDeviceId'] as num?)?.toInt() ?? 0,
+    pciSlot: data['pciSlot'] as String? ?? '',
+    isBootVga: data['isBootVga'] as bool? ?? false,
+    vramTotal: (data['vramTotal'] as num?)?.toInt() ?? 0,
+    currentClockMhz: (data['currentClockMhz'] as num?)?.toInt() ?? 0,
+    maxClockMhz: (data['maxClockMhz'] as num?)?.toInt() ?? 0,
+    renderNode: data['renderNode'] as String? ?? '',
+  );
+
+  /// DRM card name (e.g. 'card0').
+  final String card;
+
+  /// Kernel driver (e.g. 'amdgpu', 'i915', 'nouveau' or 'simpledrm').
+  final String driver;
+
+  /// PCI vendor id, or 0 for platform (non-PCI) devices.
+  final int pciVendorId;
+
+  /// PCI device id, or 0 for platform (non-PCI) devices.
+  final int pciDeviceId;
+
+  /// PCI address (e.g. '0000:03:00.0'), or empty for platform devices.
+  final String pciSlot;
+
+  /// Whether the firmware used this device for the boot console.
+  final bool isBootVga;
+
+  /// Dedicated video memory in bytes, or 0 if unknown or shared.
+  final int vramTotal;
+
+  /// Current core clock in MHz, or 0 if the driver doesn't report it.
+  final int currentClockMhz;
+
+  /// Maximum core clock in MHz, or 0 if the driver doesn't report it.
+  final int maxClockMhz;
+
+  /// Render node path (e.g. '/dev/dri/renderD128'), or empty if the device
+  /// can only drive displays.
+  final String renderNode;
+
+  /// Whether the device can be used for rendering or compute.
+  bool get isRenderCapable => renderNode.isNotEmpty;
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is GpuInfo &&
+        other.card == card &&
+        other.driver == driver &&
+        other.pciVendorId == pciVendorId &&
+        other.pciDeviceId == pciDeviceId &&
+        other.pciSlot == pciSlot &&
+        other.isBootVga == isBootVga &&
+        other.vramTotal == vramTotal &&
+        other.currentClockMhz == currentClockMhz &&
+        other.maxClockMhz == maxClockMhz &&
+        other.renderNode == renderNode;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+    card,
+    driver,
+    pciVendorId,
+    pciDeviceId,
+    pciSlot,
+    isBootVga,
+    vramTotal,
+    currentClockMhz,
+    maxClockMhz,
+    renderNode,
+  );
+
+  @override
+  String toString() =>
+      'GpuInfo('
+      'card: $card, '
+      'driver: $driver, '
+      'pciVendorId: $pciVendorId, '
+      'pciDeviceId: $pciDeviceId, '
+      'pciSlot: $pciSlot, '
+      'isBootVga: $isBootVga, '
+      'vramTotal: $vramTotal, '
+      'currentClockMhz: $currentClockMhz, '
+      'maxClockMhz: $maxClockMhz, '
+      'renderNode: $renderNode'
+      ')';
+}
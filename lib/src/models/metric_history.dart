@@ -0,0 +1,64 @@
+import 'dart:typed_data';
+
+/// A metric whose history the native sampler keeps.
+enum HistoryMetric {
+  /// CPU usage across all cores in percent (0-100).
+  cpuUsage,
+
+  /// Memory usage in percent (0-100).
+  memoryUsage,
+
+  /// Available physical memory in bytes.
+  availableMemory,
+
+  /// Available storage space in bytes.
+  availableStorage,
+
+  /// Battery level in percent (0-100). Empty on devices without a battery.
+  batteryLevel,
+}
+
+/// Bucket size of a [MetricHistory] and how far back it reaches.
+enum HistoryResolution {
+  /// 1 second buckets covering the last 10 minutes.
+  oneSecond(Duration(seconds: 1), Duration(minutes: 10)),
+
+  /// 10 second buckets covering the last hour.
+  tenSeconds(Duration(seconds: 10), Duration(hours: 1)),
+
+  /// 1 minute buckets covering the last 24 hours.
+  oneMinute(Duration(minutes: 1), Duration(hours: 24));
+
+  const HistoryResolution(this.bucket, this.retention);
+
+  /// Length of one bucket.
+  final Duration bucket;
+
+  /// How much history is kept at this resolution.
+  final Duration retention;
+}
+
+/// Rollups of a [HistoryMetric], packed as `[startMs, min, max, avg]` per
+/// bucket, oldest first.
+///
+/// This is the [Float64List] received from the platform, so reading history
+/// doesn't allocate per bucket. Buckets without samples are left out.
+extension type const MetricHistory(Float64List values) implements Float64List {
+  /// Number of doubles per bucket.
+  static const int stride = 4;
+
+  /// Number of buckets.
+  int get bucketCount => values.length ~/ stride;
+
+  /// Start of bucket [index] in milliseconds since the epoch.
+  int startMsAt(final int index) => values[index * stride].toInt();
+
+  /// Smallest value sampled in bucket [index].
+  double minAt(final int index) => values[index * stride + 1];
+
+  /// Largest value sampled in bucket [index].
+  double maxAt(final int index) => values[index * stride + 2];
+
+  /// Mean of the values sampled in bucket [index].
+  double averageAt(final int index) => values[index * stride + 3];
+}
@@ -2,10 +2,17 @@
 library;
 
 export 'battery_info.dart';
+export 'cpu_topology.dart';
 export 'device_information.dart';
+export 'device_sample.dart';
 export 'display_info.dart';
+export 'gpu_info.dart';
 export 'memory_info.dart';
+export 'metric_history.dart';
+export 'monitor_info.dart';
 export 'network_info.dart';
+export 'plugin_stats.dart';
 export 'processor_info.dart';
+export 'resource_limits.dart';
 export 'security_info.dart';
 export 'sensor_info.dart';
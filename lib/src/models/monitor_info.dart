@@ -0,0 +1,200 @@
+import 'dart:math' as math;
+
+import 'package:flutter/foundation.dart';
+
+/// Information about one physical monitor attached to the device.
+///
+/// Combines what the windowing system reports with the monitor's EDID.
+@immutable
+class MonitorInfo {
+  /// Creates a new [MonitorInfo] instance.
+  const MonitorInfo({
+    required this.name,
+    required this.manufacturer,
+    required this.model,
+    required this.x,
+    required this.y,
+    required this.width,
+    required this.height,
+    required this.scaleFactor,
+    required this.refreshRate,
+    required this.widthMm,
+    required this.heightMm,
+    required this.isPrimary,
+    required this.isHdr,
+    required this.maxLuminance,
+    required this.bitDepth,
+  });
+
+  /// Creates a [MonitorInfo] from a platform channel map.
+  factory MonitorInfo.fromMap(final Map<dynamic, dynamic> data) => MonitorInfo(
+    name: data['name'] as String? ?? '',
+    manufacturer: data['manufacturer'] as String? ?? '',
+    model: data['model'] as String? ?? '',
+    x: (data['x'] as num?)?.toInt() ?? 0,
+    y: (data['y'] as num?)?.toInt() ?? 0,
+    width: (data['width'] as num?)?.toInt() ?? 0,
+    height: (data['height'] as num?)?.toInt() ?? 0,
+    scaleFactor: (data['scaleFactor'] as num?)?.toInt() ?? 1,
+    refreshRate: (data['refreshRate'] as num?)?.toDouble() ?? 0.0,
+    widthMm: (data['widthMm'] as num?)?.toInt() ?? 0,
+    heightMm: (data['heightMm'] as num?)?.toInt() ?? 0,
+    isPrimary: data['isPrimary'] as bool? ?? false,
+    isHdr: data['isHdr'] as bool? ?? false,
+    maxLuminance: (data['maxLuminance'] as num?)?.toDouble() ?? 0.0,
+    bitDepth: (data['bitDepth'] as num?)?.toInt() ?? 0,
+  );
+
+  /// Connector name (e.g. 'eDP-1', 'HDMI-A-1'), or the model if unknown.
+  final String name;
+
+  /// Monitor manufacturer, or its three letter PNP ID from the EDID.
+  final String manufacturer;
+
+  /// Monitor model name.
+  final String model;
+
+  /// Horizontal position in logical pixels.
+  final int x;
+
+  /// Vertical position in logical pixels.
+  final int y;
+
+  /// Width in logical pixels.
+  final int width;
+
+  /// Height in logical pixels.
+  final int height;
+
+  /// Integer scale factor between logical and physical pixels.
+  final int scaleFactor;
+
+  /// Refresh rate in Hz, or 0 if unknown.
+  final double refreshRate;
+
+  /// Physical width in millimeters, or 0 if unknown.
+  final int widthMm;
+
+  /// Physical height in millimeters, or 0 if unknown.
+  final int heightMm;
+
+  /// Whether this is the primary monitor.
+  final bool isPrimary;
+
+  /// Whether the monitor advertises HDR (PQ or HLG) support.
+  final bool isHdr;
+
+  /// Desired content max luminance in cd/m², or 0 if unknown.
+  final double maxLuminance;
+
+  /// Bits per color channel, or 0 if unknown.
+  final int bitDepth;
+
+  /// Width in physical pixels.
+  int get physicalWidth => width * scaleFactor;
+
+  /// Height in physical pixels.
+  int get physicalHeight => height * scaleFactor;
+
+  /// Diagonal size in inches, or 0 if the physical size is unknown.
+  double get diagonalInches =>
+      math.sqrt(widthMm * widthMm + heightMm * heightMm) / 25.4;
+
+  /// Creates a copy of this [MonitorInfo] with the given fields replaced.
+  MonitorInfo copyWith({
+    final String? name,
+    final String? manufacturer,
+    final String? model,
+    final int? x,
+    final int? y,
+    final int? width,
+    final int? height,
+    final int? scaleFactor,
+    final double? refreshRate,
+    final int? widthMm,
+    final int? heightMm,
+    final bool? isPrimary,
+    final bool? isHdr,
+    final double? maxLuminance,
+    final int? bitDepth,
+  }) => MonitorInfo(
+    name: name ?? this.name,
+    manufacturer: manufacturer ?? this.manufacturer,
+    model: model ?? this.model,
+    x: x ?? this.x,
+    y: y ?? this.y,
+    width: width ?? this.width,
+    height: height ?? this.height,
+    scaleFactor: scaleFactor ?? this.scaleFactor,
+    refreshRate: refreshRate ?? this.refreshRate,
+    widthMm: widthMm ?? this.widthMm,
+    heightMm: heightMm ?? this.heightMm,
+    isPrimary: isPrimary ?? this.isPrimary,
+    isHdr: isHdr ?? this.isHdr,
+    maxLuminance: maxLuminance ?? this.maxLuminance,
+    bitDepth: bitDepth ?? this.bitDepth,
+  );
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is MonitorInfo &&
+        other.name == name &&
+        other.manufacturer == manufacturer &&
+        other.model == model &&
+        other.x == x &&
+        other.y == y &&
+        other.width == width &&
+        other.height == height &&
+        other.scaleFactor == scaleFactor &&
+        other.refreshRate == refreshRate &&
+        other.widthMm == widthMm &&
+        other.heightMm == heightMm &&
+        other.isPrimary == isPrimary &&
+        other.isHdr == isHdr &&
+        other.maxLuminance == maxLuminance &&
+        other.bitDepth == bitDepth;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+    name,
+    manufacturer,
+    model,
+    x,
+    y,
+    width,
+    height,
+    scaleFactor,
+    refreshRate,
+    widthMm,
+    heightMm,
+    isPrimary,
+    isHdr,
+    maxLuminance,
+    bitDepth,
+  );
+
+  @override
+  String toString() =>
+      'MonitorInfo('
+      'name: $name, '
+      'manufacturer: $manufacturer, '
+      'model: $model, '
+      'x: $x, '
+      'y: $y, '
+      'width: $width, '
+      'height: $height, '
+      'scaleFactor: $scaleFactor, '
+      'refreshRate: $refreshRate, '
+      'widthMm: $widthMm, '
+      'heightMm: $heightMm, '
+      'isPrimary: $isPrimary, '
+      'isHdr: $isHdr, '
+      'maxLuminance: $maxLuminance, '
+      'bitDepth: $bitDepth'
+      ')';
+}
@@ -0,0 +1,193 @@
+import 'package:flutter/foundation.dart';
+
+/// Timing of one native collector since the plugin was loaded.
+@immutable
+class CollectorStats {
+  /// Creates a new [CollectorStats] instance.
+  const CollectorStats({
+    required this.calls,
+    required this.totalTime,
+    required this.maxTime,
+  });
+
+  /// Creates a [CollectorStats] from a platform channel map.
+  factory CollectorStats.fromMap(final Map<dynamic, dynamic> data) =>
+      CollectorStats(
+        calls: (data['calls'] as num?)?.toInt() ?? 0,
+        totalTime: _duration(data['totalNs']),
+        maxTime: _duration(data['maxNs']),
+      );
+
+  /// Number of times the collector ran.
+  final int calls;
+
+  /// Time spent in the collector across all calls.
+  final Duration totalTime;
+
+  /// Longest single call.
+  final Duration maxTime;
+
+  /// Mean time per call, or [Duration.zero] if it never ran.
+  Duration get averageTime => calls == 0 ? Duration.zero : totalTime ~/ calls;
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is CollectorStats &&
+        other.calls == calls &&
+        other.totalTime == totalTime &&
+        other.maxTime == maxTime;
+  }
+
+  @override
+  int get hashCode => Object.hash(calls, totalTime, maxTime);
+
+  @override
+  String toString() =>
+      'CollectorStats('
+      'calls: $calls, '
+      'totalTime: $totalTime, '
+      'maxTime: $maxTime'
+      ')';
+}
+
+/// Hit and miss counts of one native cache.
+@immutable
+class CacheStats {
+  /// Creates a new [CacheStats] instance.
+  const CacheStats({
+    required this.hits,
+    required this.misses,
+    this.joins = 0,
+  });
+
+  /// Creates a [CacheStats] from a platform channel map.
+  factory CacheStats.fromMap(final Map<dynamic, dynamic> data) => CacheStats(
+    hits: (data['hits'] as num?)?.toInt() ?? 0,
+    misses: (data['misses'] as num?)?.toInt() ?? 0,
+    joins: (data['joins'] as num?)?.toInt() ?? 0,
+  );
+
+  /// Lookups answered without collecting.
+  final int hits;
+
+  /// Lookups that had to collect.
+  final int misses;
+
+  /// Lookups that waited for a collection another caller had started.
+  /// Only the coalesced query cache ('queryResult') has joins.
+  final int joins;
+
+  /// Fraction of all lookups that were hits (0-1), or 0 if there were none.
+  double get hitRatio {
+    final lookups = hits + misses + joins;
+    return lookups == 0 ? 0 : hits / lookups;
+  }
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is CacheStats &&
+        other.hits == hits &&
+        other.misses == misses &&
+        other.joins == joins;
+  }
+
+  @override
+  int get hashCode => Object.hash(hits, misses, joins);
+
+  @override
+  String toString() =>
+      'CacheStats('
+      'hits: $hits, '
+      'misses: $misses, '
+      'joins: $joins'
+      ')';
+}
+
+/// Instrumentation counters of the native plugin, accumulated since it was
+/// loaded. Useful to report from field devices where time is spent.
+@immutable
+class PluginStats {
+  /// Creates a new [PluginStats] instance.
+  const PluginStats({
+    required this.collectors,
+    required this.caches,
+    required this.fileReads,
+    required this.bytesRead,
+  });
+
+  /// Creates a [PluginStats] from a platform channel map.
+  factory PluginStats.fromMap(final Map<dynamic, dynamic> data) => PluginStats(
+    collectors: Map<String, CollectorStats>.unmodifiable(
+      (data['collectors'] as Map<dynamic, dynamic>? ?? {}).map(
+        (final key, final value) => MapEntry(
+          key as String,
+          CollectorStats.fromMap(value as Map<dynamic, dynamic>),
+        ),
+      ),
+    ),
+    caches: Map<String, CacheStats>.unmodifiable(
+      (data['caches'] as Map<dynamic, dynamic>? ?? {}).map(
+        (final key, final value) => MapEntry(
+          key as String,
+          CacheStats.fromMap(value as Map<dynamic, dynamic>),
+        ),
+      ),
+    ),
+    fileReads: (data['fileReads'] as num?)?.toInt() ?? 0,
+    bytesRead: (data['bytesRead'] as num?)?.toInt() ?? 0,
+  );
+
+  /// Timing per collector, keyed by name (e.g. 'memory', 'network').
+  final Map<String, CollectorStats> collectors;
+
+  /// Hit and miss counts per cache, keyed by name (e.g. 'queryResult').
+  final Map<String, CacheStats> caches;
+
+  /// Number of procfs and sysfs files read.
+  final int fileReads;
+
+  /// Total bytes read from procfs and sysfs.
+  final int bytesRead;
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is PluginStats &&
+        mapEquals(other.collectors, collectors) &&
+        mapEquals(other.caches, caches) &&
+        other.fileReads == fileReads &&
+        other.bytesRead == bytesRead;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+    Object.hashAllUnordered(collectors.keys),
+    Object.hashAllUnordered(collectors.values),
+    Object.hashAllUnordered(caches.values),
+    fileReads,
+    bytesRead,
+  );
+
+  @override
+  String toString() =>
+      'PluginStats('
+      'collectors: $collectors, '
+      'caches: $caches, '
+      'fileReads: $fileReads, '
+      'bytesRead: $bytesRead'
+      ')';
+}
+
+Duration _duration(final Object? nanoseconds) =>
+    Duration(microseconds: ((nanoseconds as num?)?.toInt() ?? 0) ~/ 1000);
@@ -0,0 +1,212 @@
+import 'package:flutter/foundation.dart';
+
+/// I/O throttling applied to one block device by the process's cgroup.
+///
+/// A null limit means the device is not throttled in that dimension.
+@immutable
+class IoLimit {
+  /// Creates a new [IoLimit] instance.
+  const IoLimit({
+    required this.device,
+    this.readBytesPerSecond,
+    this.writeBytesPerSecond,
+    this.readOperationsPerSecond,
+    this.writeOperationsPerSecond,
+  });
+
+  /// Creates an [IoLimit] from a platform channel map.
+  factory IoLimit.fromMap(final Map<dynamic, dynamic> data) => IoLimit(
+    device: data['device'] as String? ?? '',
+    readBytesPerSecond: _limit(data['readBps']),
+    writeBytesPerSecond: _limit(data['writeBps']),
+    readOperationsPerSecond: _limit(data['readIops']),
+    writeOperationsPerSecond: _limit(data['writeIops']),
+  );
+
+  /// Block device as 'major:minor' (e.g. '8:0').
+  final String device;
+
+  /// Maximum read throughput in bytes per second.
+  final int? readBytesPerSecond;
+
+  /// Maximum write throughput in bytes per second.
+  final int? writeBytesPerSecond;
+
+  /// Maximum read operations per second.
+  final int? readOperationsPerSecond;
+
+  /// Maximum write operations per second.
+  final int? writeOperationsPerSecond;
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is IoLimit &&
+        other.device == device &&
+        other.readBytesPerSecond == readBytesPerSecond &&
+        other.writeBytesPerSecond == writeBytesPerSecond &&
+        other.readOperationsPerSecond == readOperationsPerSecond &&
+        other.writeOperationsPerSecond == writeOperationsPerSecond;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+    device,
+    readBytesPerSecond,
+    writeBytesPerSecond,
+    readOperationsPerSecond,
+    writeOperationsPerSecond,
+  );
+
+  @override
+  String toString() =>
+      'IoLimit('
+      'device: $device, '
+      'readBytesPerSecond: $readBytesPerSecond, '
+      'writeBytesPerSecond: $writeBytesPerSecond, '
+      'readOperationsPerSecond: $readOperationsPerSecond, '
+      'writeOperationsPerSecond: $writeOperationsPerSecond'
+      ')';
+}
+
+/// The resources this process can actually use once container (cgroup)
+/// limits and CPU affinity are taken into account.
+///
+/// Inside a container the values reported by `MemoryInfo` and
+/// `ProcessorInfo` describe the host; size thread pools and caches from
+/// [effectiveCpuCount] and [effectiveMemory] instead.
+@immutable
+class ResourceLimits {
+  /// Creates a new [ResourceLimits] instance.
+  const ResourceLimits({
+    required this.cgroupVersion,
+    required this.cgroupPath,
+    required this.onlineCpuCount,
+    required this.allowedCpus,
+    required this.cpusetCpus,
+    required this.effectiveCpuCount,
+    required this.effectiveMemory,
+    this.cpuQuota,
+    this.memoryLimit,
+    this.ioLimits = const [],
+  });
+
+  /// Creates a [ResourceLimits] from a platform channel map.
+  factory ResourceLimits.fromMap(final Map<dynamic, dynamic> data) {
+    final cpuQuota = (data['cpuQuota'] as num?)?.toDouble() ?? 0.0;
+    return ResourceLimits(
+      cgroupVersion: (data['cgroupVersion'] as num?)?.toInt() ?? 0,
+      cgroupPath: data['cgroupPath'] as String? ?? '',
+      onlineCpuCount: (data['onlineCpuCount'] as num?)?.toInt() ?? 0,
+      allowedCpus: _ints(data['allowedCpus']),
+      cpusetCpus: _ints(data['cpusetCpus']),
+      effectiveCpuCount: (data['effectiveCpuCount'] as num?)?.toInt() ?? 0,
+      effectiveMemory: (data['effectiveMemory'] as num?)?.toInt() ?? 0,
+      cpuQuota: cpuQuota > 0 ? cpuQuota : null,
+      memoryLimit: _limit(data['memoryLimit']),
+      ioLimits: (data['ioLimits'] as List<dynamic>? ?? [])
+          .map((final l) => IoLimit.fromMap(l as Map<dynamic, dynamic>))
+          .toList(),
+    );
+  }
+
+  /// 2 for a pure cgroup v2 hierarchy, 1 for v1 or hybrid setups, 0 if the
+  /// process is not in a cgroup hierarchy that could be read.
+  final int cgroupVersion;
+
+  /// The process's cgroup path (e.g. '/user.slice/user-1000.slice').
+  final String cgroupPath;
+
+  /// Number of online CPUs on the host.
+  final int onlineCpuCount;
+
+  /// CPUs this process is allowed to run on.
+  final List<int> allowedCpus;
+
+  /// CPUs granted by the cgroup cpuset, or empty if unknown.
+  final List<int> cpusetCpus;
+
+  /// Number of CPUs worth of work this process can run in parallel: the
+  /// allowed CPUs capped by the rounded-up [cpuQuota].
+  final int effectiveCpuCount;
+
+  /// Physical memory capped by [memoryLimit], in bytes.
+  final int effectiveMemory;
+
+  /// CPU bandwidth limit in cores (e.g. 1.5), or null if unlimited.
+  final double? cpuQuota;
+
+  /// Memory limit in bytes, or null if unlimited.
+  final int? memoryLimit;
+
+  /// Per-device I/O throttling.
+  final List<IoLimit> ioLimits;
+
+  /// Whether the process is constrained below the host's resources.
+  bool get isConstrained =>
+      cpuQuota != null ||
+      memoryLimit != null ||
+      ioLimits.isNotEmpty ||
+      effectiveCpuCount < onlineCpuCount;
+
+  @override
+  bool operator ==(final Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+
+    return other is ResourceLimits &&
+        other.cgroupVersion == cgroupVersion &&
+        other.cgroupPath == cgroupPath &&
+        other.onlineCpuCount == onlineCpuCount &&
+        listEquals(other.allowedCpus, allowedCpus) &&
+        listEquals(other.cpusetCpus, cpusetCpus) &&
+        other.effectiveCpuCount == effectiveCpuCount &&
+        other.effectiveMemory == effectiveMemory &&
+        other.cpuQuota == cpuQuota &&
+        other.memoryLimit == memoryLimit &&
+        listEquals(other.ioLimits, ioLimits);
+  }
+
+  @override
+  int get hashCode => Object.hash(
+    cgroupVersion,
+    cgroupPath,
+    onlineCpuCount,
+    Object.hashAll(allowedCpus),
+    Object.hashAll(cpusetCpus),
+    effectiveCpuCount,
+    effectiveMemory,
+    cpuQuota,
+    memoryLimit,
+    Object.hashAll(ioLimits),
+  );
+
+  @override
+  String toString() =>
+      'ResourceLimits('
+      'cgroupVersion: $cgroupVersion, '
+      'cgroupPath: $cgroupPath, '
+      'onlineCpuCount: $onlineCpuCount, '
+      'allowedCpus: $allowedCpus, '
+      'cpusetCpus: $cpusetCpus, '
+      'effectiveCpuCount: $effectiveCpuCount, '
+      'effectiveMemory: $effectiveMemory, '
+      'cpuQuota: $cpuQuota, '
+      'memoryLimit: $memoryLimit, '
+      'ioLimits: $ioLimits'
+      ')';
+}
+
+/// Converts the native "-1 means unlimited" convention to null.
+int? _limit(final Object? value) {
+  final limit = (value as num?)?.toInt() ?? -1;
+  return limit < 0 ? null : limit;
+}
+
+List<int> _ints(final Object? value) => List<int>.unmodifiable(
+  (value as List<dynamic>? ?? []).map((final v) => (v as num).toInt()),
+);
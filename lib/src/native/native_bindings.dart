@@ -0,0 +1,8 @@
+/// Synchronous access to the native plugin through `dart:ffi`.
+///
+/// `dart:ffi` isn't available on the web, so the implementation is picked
+/// with a conditional import.
+library;
+
+export 'native_bindings_stub.dart'
+    if (dart.library.ffi) 'native_bindings_ffi.dart';
@@ -0,0 +1,181 @@
+import 'dart:ffi';
+import 'dart:io';
+
+import 'package:ffi/ffi.dart';
+
+import '../models/models.dart';
+
+/// Mirror of `fdip_sample` in `linux/include/flutter_device_info_plus/
+/// fdip_snapshot_ring.h`.
+final class _FdipSample extends Struct {
+  @Uint64()
+  external int sequence;
+
+  @Int64()
+  external int timestampMs;
+
+  @Int64()
+  external int totalPhysicalMemory;
+
+  @Int64()
+  external int availablePhysicalMemory;
+
+  @Int64()
+  external int totalStorageSpace;
+
+  @Int64()
+  external int availableStorageSpace;
+
+  @Int32()
+  external int coreCount;
+
+  @Int32()
+  external int maxFrequency;
+
+  @Int32()
+  external int batteryLevel;
+
+  @Int32()
+  external int isConnected;
+}
+
+/// Mirror of `fdip_memory` in `flutter_device_info_plus_ffi.h`.
+final class _FdipMemory extends Struct {
+  @Int64()
+  external int totalPhysicalMemory;
+
+  @Int64()
+  external int availablePhysicalMemory;
+}
+
+/// Mirror of `fdip_cpu_load` in `flutter_device_info_plus_ffi.h`.
+final class _FdipCpuLoad extends Struct {
+  @Double()
+  external double usagePercentage;
+
+  @Int32()
+  external int coreCount;
+
+  @Int32()
+  external int reserved;
+}
+
+typedef _GetCoreCountNative = Int32 Function();
+typedef _GetCoreCount = int Function();
+typedef _GetMemoryNative = Int32 Function(Pointer<_FdipMemory>);
+typedef _GetMemory = int Function(Pointer<_FdipMemory>);
+typedef _GetCpuLoadNative = Int32 Function(Pointer<_FdipCpuLoad>);
+typedef _GetCpuLoad = int Function(Pointer<_FdipCpuLoad>);
+typedef _ReadLatestNative = Int32 Function(Pointer<_FdipSample>);
+typedef _ReadLatest = int Function(Pointer<_FdipSample>);
+typedef _ReadNative = Int32 Function(Uint64, Pointer<_FdipSample>);
+typedef _Read = int Function(int, Pointer<_FdipSample>);
+
+const String _libraryName = 'libflutter_device_info_plus_plugin.so';
+
+/// Bindings to the C functions exported by the Linux plugin.
+///
+/// All calls are synchronous leaf calls and reuse one native buffer per
+/// isolate, so reading a sample doesn't allocate native memory.
+class NativeBindings {
+  NativeBindings._(final DynamicLibrary library)
+    : _readLatest = library
+          .lookupFunction<_ReadLatestNative, _ReadLatest>(
+            'fdip_ring_read_latest',
+            isLeaf: true,
+          ),
+      _read = library.lookupFunction<_ReadNative, _Read>(
+        'fdip_ring_read',
+        isLeaf: true,
+      ),
+      _getCoreCount = library
+          .lookupFunction<_GetCoreCountNative, _GetCoreCount>(
+            'fdip_get_core_count',
+            isLeaf: true,
+          ),
+      _getMemory = library.lookupFunction<_GetMemoryNative, _GetMemory>(
+        'fdip_get_memory',
+        isLeaf: true,
+      ),
+      _getCpuLoad = library.lookupFunction<_GetCpuLoadNative, _GetCpuLoad>(
+        'fdip_get_cpu_load',
+        isLeaf: true,
+      ),
+      _sample = calloc<_FdipSample>(),
+      _memory = calloc<_FdipMemory>(),
+      _cpuLoad = calloc<_FdipCpuLoad>();
+
+  /// The bindings for this isolate, or null if the native library isn't
+  /// available on this platform.
+  static NativeBindings? get instance => _instance;
+
+  static final NativeBindings? _instance = _load();
+
+  static NativeBindings? _load() {
+    if (!Platform.isLinux) {
+      return null;
+    }
+    // The plugin is normally linked into the runner, so its symbols are
+    // already visible in the process.
+    final process = DynamicLibrary.process();
+    if (process.providesSymbol('fdip_ring_read_latest')) {
+      return NativeBindings._(process);
+    }
+    try {
+      return NativeBindings._(DynamicLibrary.open(_libraryName));
+    } on ArgumentError {
+      return null;
+    }
+  }
+
+  final _ReadLatest _readLatest;
+  final _Read _read;
+  final _GetCoreCount _getCoreCount;
+  final _GetMemory _getMemory;
+  final _GetCpuLoad _getCpuLoad;
+
+  // Intentionally never freed; these small buffers live as long as the
+  // isolate.
+  final Pointer<_FdipSample> _sample;
+  final Pointer<_FdipMemory> _memory;
+  final Pointer<_FdipCpuLoad> _cpuLoad;
+
+  /// The number of online processor cores.
+  int getCoreCount() => _getCoreCount();
+
+  /// Total physical RAM in bytes, or null if it couldn't be read.
+  int? getTotalPhysicalMemory() =>
+      _getMemory(_memory) == 0 ? null : _memory.ref.totalPhysicalMemory;
+
+  /// Available physical RAM in bytes, or null if it couldn't be read.
+  int? getAvailablePhysicalMemory() =>
+      _getMemory(_memory) == 0 ? null : _memory.ref.availablePhysicalMemory;
+
+  /// CPU usage (0-100) since the previous call from any isolate, or null if
+  /// it couldn't be read.
+  double? getCpuUsagePercentage() =>
+      _getCpuLoad(_cpuLoad) == 0 ? null : _cpuLoad.ref.usagePercentage;
+
+  /// Reads the newest sample published by the shared sampler, or null if it
+  /// was never started.
+  DeviceSample? readLatestSample() =>
+      _readLatest(_sample) == 0 ? null : _toDeviceSample(_sample.ref);
+
+  /// Reads the sample with the given [sequence] number, or null if it was
+  /// not published yet or has already been overwritten.
+  DeviceSample? readSample(final int sequence) =>
+      _read(sequence, _sample) == 0 ? null : _toDeviceSample(_sample.ref);
+
+  DeviceSample _toDeviceSample(final _FdipSample sample) => DeviceSample(
+    sequence: sample.sequence,
+    timestamp: DateTime.fromMillisecondsSinceEpoch(sample.timestampMs),
+    totalPhysicalMemory: sample.totalPhysicalMemory,
+    availablePhysicalMemory: sample.availablePhysicalMemory,
+    totalStorageSpace: sample.totalStorageSpace,
+    availableStorageSpace: sample.availableStorageSpace,
+    coreCount: sample.coreCount,
+    maxFrequency: sample.maxFrequency,
+    isConnected: sample.isConnected != 0,
+    batteryLevel: sample.batteryLevel < 0 ? null : sample.batteryLevel,
+  );
+}
@@ -0,0 +1,27 @@
+import '../models/models.dart';
+
+/// Native bindings for platforms without `dart:ffi`.
+class NativeBindings {
+  const NativeBindings._();
+
+  /// Always null: there is no native library to bind to.
+  static NativeBindings? get instance => null;
+
+  /// The number of online processor cores.
+  int getCoreCount() => 0;
+
+  /// Total physical RAM in bytes.
+  int? getTotalPhysicalMemory() => null;
+
+  /// Available physical RAM in bytes.
+  int? getAvailablePhysicalMemory() => null;
+
+  /// CPU usage (0-100) since the previous call.
+  double? getCpuUsagePercentage() => null;
+
+  /// Reads the newest sample published by the shared sampler.
+  DeviceSample? readLatestSample() => null;
+
+  /// Reads the sample with the given [sequence] number.
+  DeviceSample? readSample(final int sequence) => null;
+}
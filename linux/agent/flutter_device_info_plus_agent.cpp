@@ -0,0 +1,324 @@
+// Headless agent that serves device snapshots over a Unix domain socket.
+//
+// Usage:
+//   flutter_device_info_plus_agent [--socket PATH] [--interval MS]
+//                                  [--format json|prometheus]
+//
+// Each connection may send one request line. "json" or "prometheus" picks
+// the format, and an HTTP request line ("GET /metrics HTTP/1.1") is answered
+// with an HTTP response, so `curl --unix-socket` works as well. Clients that
+// send nothing within kRequestTimeoutMs get the default format. Snapshots are
+// sampled on a background thread, so serving a request never reads procfs,
+// and clients waiting for their request line are polled together so a slow
+// or silent client never delays the others.
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "core/snapshot.h"
+#include "core/snapshot_encoders.h"
+
+using namespace flutter_device_info_plus;
+
+namespace {
+
+enum class Format { kJson, kPrometheus };
+
+struct Options {
+  std::string socketPath = "/run/user/" + std::to_string(getuid()) +
+                           "/flutter_device_info_plus.sock";
+  int intervalMs = 1000;
+  Format format = Format::kJson;
+};
+
+// How long to wait for a client's request line before using the default.
+constexpr int kRequestTimeoutMs = 10;
+// Clients waiting for their request line. When full, the oldest one is
+// answered with the default format to make room.
+constexpr size_t kMaxPendingClients = 64;
+
+struct PendingClient {
+  int fd;
+  std::chrono::steady_clock::time_point deadline;
+};
+
+volatile sig_atomic_t g_stop = 0;
+
+void HandleSignal(int) {
+  g_stop = 1;
+}
+
+bool ParseFormat(const std::string& value, Format* format) {
+  if (value == "json") {
+    *format = Format::kJson;
+  } else if (value == "prometheus") {
+    *format = Format::kPrometheus;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool ParseOptions(int argc, char** argv, Options* options) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    std::string value = argv[++i];
+    if (arg == "--socket") {
+      options->socketPath = value;
+    } else if (arg == "--interval") {
+      options->intervalMs = std::atoi(value.c_str());
+      if (options->intervalMs <= 0) return false;
+    } else if (arg == "--format") {
+      if (!ParseFormat(value, &options->format)) return false;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+void WriteAll(int fd, const std::string& data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t n = write(fd, data.data() + written, data.size() - written);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      // Client sockets are non-blocking; give a slow reader a moment.
+      struct pollfd pfd = {fd, POLLOUT, 0};
+      if (errno == EAGAIN && poll(&pfd, 1, kRequestTimeoutMs) > 0) continue;
+      return;
+    }
+    written += static_cast<size_t>(n);
+  }
+}
+
+// Reads the request line already buffered on |fd| without blocking. Returns
+// an empty string if the client sent nothing (yet).
+std::string ReadRequestLine(int fd) {
+  char buffer[512];
+  ssize_t n = recv(fd, buffer, sizeof(buffer) - 1, MSG_DONTWAIT);
+  if (n <= 0) {
+    return "";
+  }
+  buffer[n] = '\0';
+  std::string line = buffer;
+  size_t end = line.find_first_of("\r\n");
+  return end == std::string::npos ? line : line.substr(0, end);
+}
+
+// Answers |request| on |fd| and closes it.
+void ServeClient(int fd, const std::string& request,
+                 const SnapshotSampler& sampler, const Options& options) {
+  bool http = request.compare(0, 4, "GET ") == 0;
+
+  Format format = options.format;
+  if (request.find("prometheus") != std::string::npos ||
+      request.find("/metrics") != std::string::npos) {
+    format = Format::kPrometheus;
+  } else if (request.find("json") != std::string::npos) {
+    format = Format::kJson;
+  }
+
+  std::shared_ptr<const DeviceSnapshot> snapshot = sampler.Latest();
+  std::string body = format == Format::kJson
+                         ? EncodeSnapshotJson(*snapshot) + "\n"
+                         : EncodeSnapshotPrometheus(*snapshot);
+  if (http) {
+    const char* contentType = format == Format::kJson
+                                  ? "application/json"
+                                  : "text/plain; version=0.0.4";
+    WriteAll(fd, std::string("HTTP/1.0 200 OK\r\nContent-Type: ") +
+                     contentType + "\r\nContent-Length: " +
+                     std::to_string(body.size()) +
+                     "\r\nConnection: close\r\n\r\n");
+  }
+  WriteAll(fd, body);
+  close(fd);
+}
+
+// Accepts every queued connection. Clients whose request line has already
+// arrived are answered right away, the others wait in |pending|.
+void AcceptClients(int listener, const SnapshotSampler& sampler,
+                   const Options& options,
+                   std::vector<PendingClient>* pending) {
+  while (true) {
+    int client =
+        accept4(listener, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+    if (client < 0) {
+      if (errno == EINTR) continue;
+      return;
+    }
+    std::string request = ReadRequestLine(client);
+    if (!request.empty()) {
+      ServeClient(client, request, sampler, options);
+      continue;
+    }
+    if (pending->size() >= kMaxPendingClients) {
+      ServeClient(pending->front().fd, "", sampler, options);
+      pending->erase(pending->begin());
+    }
+    pending->push_back(
+        {client, std::chrono::steady_clock::now() +
+                     std::chrono::milliseconds(kRequestTimeoutMs)});
+  }
+}
+
+// Removes a socket left at |addr| by an agent that exited without cleaning
+// up. Fails if another agent still accepts connections there, or if the
+// path is something other than a socket.
+bool RemoveStaleSocket(const struct sockaddr_un& addr) {
+  const char* path = addr.sun_path;
+  struct stat info;
+  if (lstat(path, &info) != 0) {
+    return errno == ENOENT;
+  }
+  if (!S_ISSOCK(info.st_mode)) {
+    fprintf(stderr, "%s exists and is not a socket\n", path);
+    return false;
+  }
+
+  int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (probe < 0) {
+    perror("socket");
+    return false;
+  }
+  int result = connect(probe, reinterpret_cast<const struct sockaddr*>(&addr),
+                       sizeof(addr));
+  int error = errno;
+  close(probe);
+  if (result == 0) {
+    fprintf(stderr, "Another agent is already listening on %s\n", path);
+    return false;
+  }
+  if (error != ECONNREFUSED) {
+    fprintf(stderr, "%s: %s\n", path, strerror(error));
+    return false;
+  }
+  if (unlink(path) != 0 && errno != ENOENT) {
+    perror(path);
+    return false;
+  }
+  return true;
+}
+
+int OpenListener(const std::string& path) {
+  struct sockaddr_un addr;
+  if (path.size() >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "Socket path is too long: %s\n", path.c_str());
+    return -1;
+  }
+
+  int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+  if (fd < 0) {
+    perror("socket");
+    return -1;
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+  if (!RemoveStaleSocket(addr)) {
+    close(fd);
+    return -1;
+  }
+  if (bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      listen(fd, 16) != 0) {
+    perror(path.c_str());
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, &options)) {
+    fprintf(stderr,
+            "Usage: %s [--socket PATH] [--interval MS] "
+            "[--format json|prometheus]\n",
+            argv[0]);
+    return 2;
+  }
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = HandleSignal;
+  sigaction(SIGINT, &action, nullptr);
+  sigaction(SIGTERM, &action, nullptr);
+  signal(SIGPIPE, SIG_IGN);
+
+  int listener = OpenListener(options.socketPath);
+  if (listener < 0) {
+    return 1;
+  }
+
+  SnapshotSampler sampler(std::chrono::milliseconds(options.intervalMs));
+  sampler.Start();
+
+  // The snapshot fits in the socket buffer, so only waiting for request
+  // lines could block; that is done here for all clients at once.
+  std::vector<PendingClient> pending;
+  std::vector<struct pollfd> fds;
+  while (!g_stop) {
+    fds.assign(1, {listener, POLLIN, 0});
+    for (const PendingClient& client : pending) {
+      fds.push_back({client.fd, POLLIN, 0});
+    }
+    int timeout = -1;
+    if (!pending.empty()) {
+      auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+          pending.front().deadline - std::chrono::steady_clock::now());
+      timeout = static_cast<int>(std::max<int64_t>(wait.count(), 0));
+    }
+    if (poll(fds.data(), fds.size(), timeout) < 0) {
+      if (errno == EINTR) continue;
+      perror("poll");
+      break;
+    }
+
+    // Serve clients that sent their request line or ran out of time. Their
+    // deadlines are in accept order, so |pending| stays sorted.
+    auto now = std::chrono::steady_clock::now();
+    std::vector<PendingClient> waiting;
+    for (size_t i = 0; i < pending.size(); ++i) {
+      const PendingClient& client = pending[i];
+      if (fds[i + 1].revents != 0) {
+        ServeClient(client.fd, ReadRequestLine(client.fd), sampler, options);
+      } else if (client.deadline <= now) {
+        ServeClient(client.fd, "", sampler, options);
+      } else {
+        waiting.push_back(client);
+      }
+    }
+    pending.swap(waiting);
+
+    if (fds[0].revents & POLLIN) {
+      AcceptClients(listener, sampler, options, &pending);
+    }
+  }
+
+  for (const PendingClient& client : pending) {
+    close(client.fd);
+  }
+  sampler.Stop();
+  close(listener);
+  unlink(options.socketPath.c_str());
+  return 0;
+}
@@ -0,0 +1,299 @@
+#include "batch_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define FDIP_HAS_IO_URING 1
+#endif
+
+#include "stats.h"
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+#if defined(FDIP_HAS_IO_URING) && defined(__NR_io_uring_setup)
+
+int IoUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned submit, unsigned wait, unsigned flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, fd, submit, wait, flags, nullptr, 0));
+}
+
+int IoUringRegister(int fd, unsigned opcode, const void* args,
+                    unsigned count) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_register, fd, opcode, args, count));
+}
+
+unsigned LoadAcquire(const unsigned* value) {
+  return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(unsigned* value, unsigned newValue) {
+  __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+}
+
+#endif
+
+}  // namespace
+
+#if defined(FLUTTER_DEVICE_INFO_PLUS_ENABLE_IO_URING)
+BatchReader::BatchReader() : BatchReader(true) {}
+#else
+BatchReader::BatchReader() : BatchReader(false) {}
+#endif
+
+BatchReader::BatchReader(bool useIoUring) : useIoUring_(useIoUring) {}
+
+BatchReader::~BatchReader() {
+  TearDownRing();
+  for (int fd : fds_) {
+    close(fd);
+  }
+}
+
+int BatchReader::Add(const std::string& path, size_t maxSize) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return -1;
+  }
+  fds_.push_back(fd);
+  buffers_.emplace_back(maxSize < 2 ? 2 : maxSize, '\0');
+  sizes_.push_back(-1);
+  // The ring is sized and registered for the current set of files.
+  dirty_ = true;
+  return static_cast<int>(fds_.size() - 1);
+}
+
+size_t BatchReader::ReadAll() {
+  if (fds_.empty()) {
+    return 0;
+  }
+  if (dirty_) {
+    TearDownRing();
+    if (useIoUring_ && !SetUpRing()) {
+      // Don't retry every tick once io_uring turned out to be unusable.
+      TearDownRing();
+      useIoUring_ = false;
+    }
+    dirty_ = false;
+  }
+  // A failed ring read has disabled io_uring; redo the tick with pread.
+  if (ringFd_ < 0 || !ReadWithRing()) {
+    ReadWithPread();
+  }
+
+  size_t succeeded = 0;
+  for (size_t i = 0; i < fds_.size(); ++i) {
+    if (sizes_[i] >= 0) {
+      buffers_[i][sizes_[i]] = '\0';
+      RecordFileRead(static_cast<size_t>(sizes_[i]));
+      ++succeeded;
+    } else {
+      buffers_[i][0] = '\0';
+    }
+  }
+  return succeeded;
+}
+
+const char* BatchReader::Data(int index) const {
+  if (index < 0 || static_cast<size_t>(index) >= buffers_.size()) {
+    return "";
+  }
+  return buffers_[index].data();
+}
+
+long BatchReader::Size(int index) const {
+  if (index < 0 || static_cast<size_t>(index) >= sizes_.size()) {
+    return -1;
+  }
+  return sizes_[index];
+}
+
+void BatchReader::ReadWithPread() {
+  for (size_t i = 0; i < fds_.size(); ++i) {
+    ssize_t n;
+    do {
+      n = pread(fds_[i], buffers_[i].data(), buffers_[i].size() - 1, 0);
+    } while (n < 0 && errno == EINTR);
+    sizes_[i] = n;
+  }
+}
+
+#if defined(FDIP_HAS_IO_URING) && defined(__NR_io_uring_setup)
+
+bool BatchReader::SetUpRing() {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  unsigned entries = static_cast<unsigned>(fds_.size());
+  ringFd_ = IoUringSetup(entries, &params);
+  if (ringFd_ < 0) {
+    return false;
+  }
+
+  sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cqRingSize_ =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (singleMmap && cqRingSize_ > sqRingSize_) {
+    sqRingSize_ = cqRingSize_;
+  }
+  sqRing_ = mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE, ringFd_, IORING_OFF_SQ_RING);
+  if (sqRing_ == MAP_FAILED) {
+    sqRing_ = nullptr;
+    return false;
+  }
+  if (singleMmap) {
+    cqRing_ = sqRing_;
+  } else {
+    cqRing_ = mmap(nullptr, cqRingSize_, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ringFd_, IORING_OFF_CQ_RING);
+    if (cqRing_ == MAP_FAILED) {
+      cqRing_ = nullptr;
+      return false;
+    }
+  }
+  sqesSize_ = params.sq_entries * sizeof(struct io_uring_sqe);
+  sqes_ = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, ringFd_, IORING_OFF_SQES);
+  if (sqes_ == MAP_FAILED) {
+    sqes_ = nullptr;
+    return false;
+  }
+
+  char* sq = static_cast<char*>(sqRing_);
+  sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  sqMask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  char* cq = static_cast<char*>(cqRing_);
+  cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  cqMask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  cqes_ = cq + params.cq_off.cqes;
+
+  // Registered files and buffers save a file table lookup and a page
+  // pinning per read. They may be refused (e.g. RLIMIT_MEMLOCK), in which
+  // case plain reads are submitted instead.
+  std::vector<struct iovec> iovecs(fds_.size());
+  for (size_t i = 0; i < fds_.size(); ++i) {
+    iovecs[i].iov_base = buffers_[i].data();
+    iovecs[i].iov_len = buffers_[i].size();
+  }
+  if (IoUringRegister(ringFd_, IORING_REGISTER_FILES, fds_.data(), entries) ==
+      0) {
+    if (IoUringRegister(ringFd_, IORING_REGISTER_BUFFERS, iovecs.data(),
+                        entries) == 0) {
+      registered_ = true;
+    } else {
+      IoUringRegister(ringFd_, IORING_UNREGISTER_FILES, nullptr, 0);
+    }
+  }
+  return true;
+}
+
+void BatchReader::TearDownRing() {
+  if (sqes_ != nullptr) munmap(sqes_, sqesSize_);
+  if (cqRing_ != nullptr && cqRing_ != sqRing_) munmap(cqRing_, cqRingSize_);
+  if (sqRing_ != nullptr) munmap(sqRing_, sqRingSize_);
+  if (ringFd_ >= 0) close(ringFd_);
+  ringFd_ = -1;
+  registered_ = false;
+  sqRing_ = cqRing_ = sqes_ = nullptr;
+}
+
+bool BatchReader::ReadWithRing() {
+  struct io_uring_sqe* sqes = static_cast<struct io_uring_sqe*>(sqes_);
+  unsigned tail = *sqTail_;
+  for (size_t i = 0; i < fds_.size(); ++i) {
+    unsigned index = tail & *sqMask_;
+    struct io_uring_sqe* sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->addr = reinterpret_cast<uint64_t>(buffers_[i].data());
+    sqe->len = static_cast<unsigned>(buffers_[i].size() - 1);
+    sqe->off = 0;
+    sqe->user_data = i;
+    if (registered_) {
+      sqe->opcode = IORING_OP_READ_FIXED;
+      sqe->flags = IOSQE_FIXED_FILE;
+      sqe->fd = static_cast<int>(i);
+      sqe->buf_index = static_cast<uint16_t>(i);
+    } else {
+      sqe->opcode = IORING_OP_READ;
+      sqe->fd = fds_[i];
+    }
+    sqArray_[index] = index;
+    ++tail;
+  }
+  StoreRelease(sqTail_, tail);
+
+  unsigned count = static_cast<unsigned>(fds_.size());
+  int submitted;
+  do {
+    submitted = IoUringEnter(ringFd_, count, count, IORING_ENTER_GETEVENTS);
+  } while (submitted < 0 && errno == EINTR);
+  // Any failure leaves reads in flight or completions unreaped, which the
+  // next tick would mistake for its own, so the ring is dropped and the
+  // pread fallback takes over for good.
+  if (submitted != static_cast<int>(count)) {
+    TearDownRing();
+    useIoUring_ = false;
+    return false;
+  }
+
+  unsigned completed = 0;
+  bool failed = false;
+  struct io_uring_cqe* cqes = static_cast<struct io_uring_cqe*>(cqes_);
+  while (completed < count) {
+    unsigned head = *cqHead_;
+    unsigned cqTail = LoadAcquire(cqTail_);
+    if (head == cqTail) {
+      if (IoUringEnter(ringFd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+          errno != EINTR) {
+        break;
+      }
+      continue;
+    }
+    for (; head != cqTail; ++head, ++completed) {
+      const struct io_uring_cqe& cqe = cqes[head & *cqMask_];
+      // A negative result can mean the opcode itself is unsupported, e.g.
+      // IORING_OP_READ before Linux 5.6, which pread gets right.
+      if (cqe.res < 0 || cqe.user_data >= sizes_.size()) {
+        failed = true;
+      } else {
+        sizes_[cqe.user_data] = cqe.res;
+      }
+    }
+    StoreRelease(cqHead_, head);
+  }
+  if (failed || completed != count) {
+    TearDownRing();
+    useIoUring_ = false;
+    return false;
+  }
+  return true;
+}
+
+#else
+
+bool BatchReader::SetUpRing() { return false; }
+
+void BatchReader::TearDownRing() {}
+
+bool BatchReader::ReadWithRing() { return false; }
+
+#endif
+
+}  // namespace flutter_device_info_plus
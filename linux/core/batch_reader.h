@@ -0,0 +1,90 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_BATCH_READER_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_BATCH_READER_H_
+
+#include <sys/uio.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace flutter_device_info_plus {
+
+// Re-reads a fixed set of small procfs/sysfs files, such as the ones a
+// sampling tick polls, keeping them open between reads.
+//
+// When io_uring is available every ReadAll() is a single io_uring_enter
+// submitting one read per file against registered file descriptors and
+// buffers. Otherwise, e.g. on kernels older than 5.1 or under a seccomp
+// profile that blocks io_uring, it falls back to one pread per file. The
+// fallback is also permanent after any failed or short ring read.
+// Either way the open/close syscalls of ReadFile are gone, which is most
+// of the cost: sysfs reads complete synchronously, so io_uring mostly
+// saves syscall transitions and is therefore opt-in.
+//
+// Not thread-safe.
+class BatchReader {
+ public:
+  // Uses io_uring if the library was built with
+  // FLUTTER_DEVICE_INFO_PLUS_ENABLE_IO_URING, pread otherwise.
+  BatchReader();
+  // |useIoUring| = false forces the pread path.
+  explicit BatchReader(bool useIoUring);
+  ~BatchReader();
+
+  // Disallow copy and assign.
+  BatchReader(const BatchReader&) = delete;
+  BatchReader& operator=(const BatchReader&) = delete;
+
+  // Opens |path| for every following ReadAll(), reading at most
+  // |maxSize| - 1 bytes of it. Returns its index, or -1 if it can't be
+  // opened.
+  int Add(const std::string& path, size_t maxSize = 256);
+
+  // Reads every file. Returns the number of files read successfully.
+  size_t ReadAll();
+
+  // Null-terminated contents of file |index| from the last ReadAll(), or
+  // an empty string if that read failed.
+  const char* Data(int index) const;
+  // Size of Data(index), or -1 if the read failed.
+  long Size(int index) const;
+
+  size_t Count() const { return fds_.size(); }
+
+  // Whether the last ReadAll() went through io_uring.
+  bool UsingIoUring() const { return ringFd_ >= 0; }
+
+ private:
+  bool SetUpRing();
+  void TearDownRing();
+  bool ReadWithRing();
+  void ReadWithPread();
+
+  bool useIoUring_;
+  bool dirty_ = true;
+
+  std::vector<int> fds_;
+  std::vector<std::vector<char>> buffers_;
+  std::vector<long> sizes_;
+
+  // io_uring state, valid while ringFd_ >= 0.
+  int ringFd_ = -1;
+  bool registered_ = false;
+  void* sqRing_ = nullptr;
+  size_t sqRingSize_ = 0;
+  void* cqRing_ = nullptr;
+  size_t cqRingSize_ = 0;
+  void* sqes_ = nullptr;
+  size_t sqesSize_ = 0;
+  unsigned* sqHead_ = nullptr;
+  unsigned* sqTail_ = nullptr;
+  unsigned* sqMask_ = nullptr;
+  unsigned* sqArray_ = nullptr;
+  unsigned* cqHead_ = nullptr;
+  unsigned* cqTail_ = nullptr;
+  unsigned* cqMask_ = nullptr;
+  void* cqes_ = nullptr;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_BATCH_READER_H_
@@ -0,0 +1,353 @@
+#include "cgroup.h"
+
+#include <sys/stat.h>
+#include <sys/sysinfo.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "collectors.h"
+#include "file_util.h"
+#include "stats.h"
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+// v1 reports "no limit" as a huge page-aligned number.
+constexpr int64_t kUnlimitedThreshold = int64_t{1} << 62;
+
+struct CgroupMount {
+  std::string root;
+  std::string mountPoint;
+};
+
+struct CgroupLayout {
+  // Path of the unified (v2) cgroup, empty if there is none.
+  std::string unifiedPath;
+  // Path per v1 controller, e.g. "memory" -> "/user.slice".
+  std::map<std::string, std::string> controllerPaths;
+
+  bool hasUnifiedMount = false;
+  CgroupMount unifiedMount;
+  std::map<std::string, CgroupMount> controllerMounts;
+};
+
+std::vector<std::string> Split(const std::string& value, char separator) {
+  std::vector<std::string> parts;
+  std::stringstream stream(value);
+  std::string part;
+  while (std::getline(stream, part, separator)) {
+    parts.push_back(part);
+  }
+  return parts;
+}
+
+bool IsDirectory(const std::string& path) {
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+CgroupLayout ReadLayout(const std::string& root) {
+  CgroupLayout layout;
+
+  // hierarchy-ID:controller-list:cgroup-path
+  std::stringstream cgroups(ReadFile(root + "/proc/self/cgroup"));
+  std::string line;
+  while (std::getline(cgroups, line)) {
+    size_t first = line.find(':');
+    size_t second = line.find(':', first + 1);
+    if (first == std::string::npos || second == std::string::npos) continue;
+    std::string controllers = line.substr(first + 1, second - first - 1);
+    std::string path = line.substr(second + 1);
+    if (controllers.empty()) {
+      layout.unifiedPath = path;
+    } else {
+      for (const auto& controller : Split(controllers, ',')) {
+        layout.controllerPaths[controller] = path;
+      }
+    }
+  }
+
+  // id parent major:minor root mount-point options [tags] - type source opts
+  std::stringstream mounts(ReadFile(root + "/proc/self/mountinfo"));
+  while (std::getline(mounts, line)) {
+    std::vector<std::string> fields = Split(line, ' ');
+    auto separator = std::find(fields.begin(), fields.end(), "-");
+    if (fields.size() < 5 || separator == fields.end() ||
+        fields.end() - separator < 4) {
+      continue;
+    }
+    const std::string& type = *(separator + 1);
+    CgroupMount mount{fields[3], root + fields[4]};
+    if (type == "cgroup2") {
+      layout.hasUnifiedMount = true;
+      layout.unifiedMount = mount;
+    } else if (type == "cgroup") {
+      for (const auto& option : Split(*(separator + 3), ',')) {
+        if (layout.controllerPaths.count(option) > 0) {
+          layout.controllerMounts[option] = mount;
+        }
+      }
+    }
+  }
+  return layout;
+}
+
+// Maps a cgroup path to its directory under |mount|. Inside a container the
+// mount's root is often the container's own cgroup, or the path isn't
+// visible at all; in both cases the mount point itself is the best guess.
+std::string ResolveDirectory(const CgroupMount& mount, const std::string& path) {
+  std::string relative;
+  if (mount.root == "/") {
+    relative = path;
+  } else if (path.compare(0, mount.root.size(), mount.root) == 0) {
+    relative = path.substr(mount.root.size());
+  }
+  std::string directory = mount.mountPoint + relative;
+  while (directory.size() > 1 && directory.back() == '/') {
+    directory.pop_back();
+  }
+  return IsDirectory(directory) ? directory : mount.mountPoint;
+}
+
+// Returns |directory| and each of its parents up to |mountPoint|.
+std::vector<std::string> Ancestors(const std::string& directory,
+                                   const std::string& mountPoint) {
+  std::vector<std::string> result;
+  std::string current = directory;
+  while (true) {
+    result.push_back(current);
+    if (current.size() <= mountPoint.size()) break;
+    size_t slash = current.find_last_of('/');
+    if (slash == std::string::npos || slash < mountPoint.size()) break;
+    current = current.substr(0, slash);
+  }
+  return result;
+}
+
+// Parses a limit value where "max" (or a missing file) means unlimited.
+int64_t ParseLimit(const std::string& value) {
+  std::string trimmed = Trim(value);
+  if (trimmed.empty() || trimmed == "max") {
+    return -1;
+  }
+  int64_t limit = std::strtoll(trimmed.c_str(), nullptr, 10);
+  return limit >= kUnlimitedThreshold || limit < 0 ? -1 : limit;
+}
+
+int64_t MinLimit(int64_t a, int64_t b) {
+  if (a < 0) return b;
+  if (b < 0) return a;
+  return std::min(a, b);
+}
+
+double MinQuota(double a, double b) {
+  if (a <= 0) return b;
+  if (b <= 0) return a;
+  return std::min(a, b);
+}
+
+// Merges the lines of the v2 io.max file at |path| into |limits|, keeping
+// the tightest value per device and field.
+// Format: "8:0 rbps=max wbps=1048576 riops=max wiops=max"
+void ReadIoMax(const std::string& path, std::vector<IoLimit>* limits) {
+  std::stringstream io(ReadFile(path));
+  std::string line;
+  while (std::getline(io, line)) {
+    std::vector<std::string> fields = Split(line, ' ');
+    if (fields.empty() || fields[0].empty()) continue;
+    auto existing = std::find_if(
+        limits->begin(), limits->end(),
+        [&](const IoLimit& limit) { return limit.device == fields[0]; });
+    if (existing == limits->end()) {
+      limits->push_back(IoLimit());
+      limits->back().device = fields[0];
+      existing = limits->end() - 1;
+    }
+    for (size_t i = 1; i < fields.size(); ++i) {
+      size_t equals = fields[i].find('=');
+      if (equals == std::string::npos) continue;
+      std::string key = fields[i].substr(0, equals);
+      int64_t value = ParseLimit(fields[i].substr(equals + 1));
+      int64_t IoLimit::*field = nullptr;
+      if (key == "rbps") field = &IoLimit::readBps;
+      else if (key == "wbps") field = &IoLimit::writeBps;
+      else if (key == "riops") field = &IoLimit::readIops;
+      else if (key == "wiops") field = &IoLimit::writeIops;
+      if (field != nullptr) {
+        (*existing).*field = MinLimit((*existing).*field, value);
+      }
+    }
+  }
+}
+
+void ResolveV2(const CgroupLayout& layout, ResourceLimits* limits) {
+  std::string leaf = ResolveDirectory(layout.unifiedMount, layout.unifiedPath);
+  for (const auto& directory :
+       Ancestors(leaf, layout.unifiedMount.mountPoint)) {
+    // cpu.max: "$MAX $PERIOD"
+    std::vector<std::string> cpuMax =
+        Split(Trim(ReadFile(directory + "/cpu.max")), ' ');
+    if (cpuMax.size() == 2 && cpuMax[0] != "max") {
+      double period = std::strtod(cpuMax[1].c_str(), nullptr);
+      if (period > 0) {
+        limits->cpuQuota = MinQuota(
+            limits->cpuQuota, std::strtod(cpuMax[0].c_str(), nullptr) / period);
+      }
+    }
+    limits->memoryLimit = MinLimit(limits->memoryLimit,
+                                   ParseLimit(ReadFile(directory + "/memory.max")));
+    ReadIoMax(directory + "/io.max", &limits->ioLimits);
+  }
+
+  limits->cpusetCpus = ParseCpuList(ReadFile(leaf + "/cpuset.cpus.effective"));
+}
+
+// Reads "major:minor value" lines of a v1 blkio throttle file into |limits|.
+void ReadBlkioThrottle(const std::string& path,
+                       int64_t IoLimit::*field,
+                       std::vector<IoLimit>* limits) {
+  std::stringstream throttle(ReadFile(path));
+  std::string line;
+  while (std::getline(throttle, line)) {
+    std::vector<std::string> fields = Split(line, ' ');
+    if (fields.size() != 2) continue;
+    auto existing = std::find_if(
+        limits->begin(), limits->end(),
+        [&](const IoLimit& limit) { return limit.device == fields[0]; });
+    if (existing == limits->end()) {
+      limits->push_back(IoLimit());
+      limits->back().device = fields[0];
+      existing = limits->end() - 1;
+    }
+    (*existing).*field = ParseLimit(fields[1]);
+  }
+}
+
+void ResolveV1(const CgroupLayout& layout, ResourceLimits* limits) {
+  auto directoryFor = [&layout](const std::string& controller) {
+    auto mount = layout.controllerMounts.find(controller);
+    if (mount == layout.controllerMounts.end()) {
+      return std::string();
+    }
+    return ResolveDirectory(mount->second,
+                            layout.controllerPaths.at(controller));
+  };
+
+  std::string cpu = directoryFor("cpu");
+  if (!cpu.empty()) {
+    const std::string& mountPoint = layout.controllerMounts.at("cpu").mountPoint;
+    for (const auto& directory : Ancestors(cpu, mountPoint)) {
+      int64_t quota = ParseLimit(ReadFile(directory + "/cpu.cfs_quota_us"));
+      int64_t period = ParseLimit(ReadFile(directory + "/cpu.cfs_period_us"));
+      if (quota > 0 && period > 0) {
+        limits->cpuQuota = MinQuota(limits->cpuQuota,
+                                    static_cast<double>(quota) / period);
+      }
+    }
+  }
+
+  std::string memory = directoryFor("memory");
+  if (!memory.empty()) {
+    // hierarchical_memory_limit already accounts for every ancestor.
+    std::stringstream stat(ReadFile(memory + "/memory.stat"));
+    std::string line;
+    while (std::getline(stat, line)) {
+      if (line.compare(0, 26, "hierarchical_memory_limit ") == 0) {
+        limits->memoryLimit = ParseLimit(line.substr(26));
+        break;
+      }
+    }
+    if (limits->memoryLimit < 0) {
+      limits->memoryLimit =
+          ParseLimit(ReadFile(memory + "/memory.limit_in_bytes"));
+    }
+  }
+
+  std::string cpuset = directoryFor("cpuset");
+  if (!cpuset.empty()) {
+    std::string cpus = ReadFile(cpuset + "/cpuset.effective_cpus");
+    if (cpus.empty()) {
+      cpus = ReadFile(cpuset + "/cpuset.cpus");
+    }
+    limits->cpusetCpus = ParseCpuList(cpus);
+  }
+
+  std::string blkio = directoryFor("blkio");
+  if (!blkio.empty()) {
+    ReadBlkioThrottle(blkio + "/blkio.throttle.read_bps_device",
+                      &IoLimit::readBps, &limits->ioLimits);
+    ReadBlkioThrottle(blkio + "/blkio.throttle.write_bps_device",
+                      &IoLimit::writeBps, &limits->ioLimits);
+    ReadBlkioThrottle(blkio + "/blkio.throttle.read_iops_device",
+                      &IoLimit::readIops, &limits->ioLimits);
+    ReadBlkioThrottle(blkio + "/blkio.throttle.write_iops_device",
+                      &IoLimit::writeIops, &limits->ioLimits);
+  }
+}
+
+}  // namespace
+
+CgroupCollector::CgroupCollector(std::string root) : root_(std::move(root)) {}
+
+ResourceLimits CgroupCollector::Collect(bool refresh) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool hit = cached_ && !refresh;
+  RecordCacheLookup(StatCache::kResourceLimits, hit);
+  if (!hit) {
+    ScopedCollectTimer timer(StatCollector::kResourceLimits);
+    limits_ = Resolve(root_);
+    cached_ = true;
+  }
+  return limits_;
+}
+
+ResourceLimits CgroupCollector::Resolve(const std::string& root) {
+  ResourceLimits limits;
+  limits.onlineCpuCount = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+  limits.allowedCpus = ProcessorCollector::AllowedCpus();
+
+  CgroupLayout layout = ReadLayout(root);
+  // Hybrid systems mount the v2 hierarchy without any controllers, so the
+  // v1 controller mounts take precedence.
+  bool v1 = layout.controllerMounts.count("cpu") > 0 ||
+            layout.controllerMounts.count("memory") > 0;
+  if (v1) {
+    limits.cgroupVersion = 1;
+    limits.cgroupPath = layout.controllerPaths.count("memory") > 0
+                            ? layout.controllerPaths.at("memory")
+                            : layout.controllerPaths.begin()->second;
+    ResolveV1(layout, &limits);
+  } else if (layout.hasUnifiedMount) {
+    limits.cgroupVersion = 2;
+    limits.cgroupPath = layout.unifiedPath;
+    ResolveV2(layout, &limits);
+  }
+
+  int allowed = limits.allowedCpus.empty()
+                    ? limits.onlineCpuCount
+                    : static_cast<int>(limits.allowedCpus.size());
+  limits.effectiveCpuCount = allowed;
+  if (limits.cpuQuota > 0) {
+    limits.effectiveCpuCount = std::max(
+        1, std::min(allowed, static_cast<int>(std::ceil(limits.cpuQuota))));
+  }
+
+  struct sysinfo info;
+  int64_t physical = sysinfo(&info) == 0
+                         ? static_cast<int64_t>(info.totalram) * info.mem_unit
+                         : 0;
+  limits.effectiveMemory = limits.memoryLimit >= 0
+                               ? std::min(physical, limits.memoryLimit)
+                               : physical;
+  return limits;
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,37 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_CGROUP_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_CGROUP_H_
+
+#include <mutex>
+#include <string>
+
+#include "device_info_types.h"
+
+namespace flutter_device_info_plus {
+
+// Resolves the effective CPU, memory and I/O limits of this process from
+// cgroup v1 or v2 (including hybrid setups) and sched_getaffinity.
+//
+// Limits are walked up the hierarchy, so a slice limit applies to every
+// cgroup below it. Results are cached because they rarely change; pass
+// |refresh| to re-read them. Thread-safe.
+class CgroupCollector {
+ public:
+  // |root| is prepended to every procfs and cgroupfs path; tests point it
+  // at a fixture tree.
+  explicit CgroupCollector(std::string root = std::string());
+
+  ResourceLimits Collect(bool refresh = false);
+
+ private:
+  static ResourceLimits Resolve(const std::string& root);
+
+  const std::string root_;
+
+  std::mutex mutex_;
+  bool cached_ = false;
+  ResourceLimits limits_;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_CGROUP_H_
@@ -0,0 +1,610 @@
+#include "collectors.h"
+
+#include <sched.h>
+#include <sys/utsname.h>
+#include <sys/sysinfo.h>
+#include <sys/statvfs.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <linux/if_packet.h>
+#include <dirent.h>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "file_util.h"
+#include "stats.h"
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+// Returns the trimmed value of the first "|key| : value" line in /proc/cpuinfo
+// or an empty string if there is none.
+std::string FindCpuInfoValue(const std::string& cpuinfo, const char* key) {
+  size_t pos = cpuinfo.find(key);
+  if (pos == std::string::npos) {
+    return "";
+  }
+  size_t colon = cpuinfo.find(":", pos);
+  if (colon == std::string::npos) {
+    return "";
+  }
+  size_t start = colon + 1;
+  size_t end = cpuinfo.find("\n", start);
+  if (end == std::string::npos) {
+    return "";
+  }
+  return Trim(cpuinfo.substr(start, end - start));
+}
+
+std::string NormalizeArchitecture(const std::string& machine) {
+  if (machine.find("x86_64") != std::string::npos ||
+      machine.find("amd64") != std::string::npos) {
+    return "x86_64";
+  } else if (machine.find("arm64") != std::string::npos ||
+             machine.find("aarch64") != std::string::npos) {
+    return "arm64";
+  } else if (machine.find("arm") != std::string::npos) {
+    return "arm";
+  } else if (machine.find("i386") != std::string::npos ||
+             machine.find("i686") != std::string::npos) {
+    return "x86";
+  }
+  return machine;
+}
+
+std::vector<std::string> ParseProcessorFeatures(const std::string& cpuinfo) {
+  static const struct {
+    const char* flag;
+    const char* name;
+  } kFeatures[] = {
+      {"neon", "NEON"}, {"vfp", "VFP"},   {"avx", "AVX"},   {"avx2", "AVX2"},
+      {"sse", "SSE"},   {"sse2", "SSE2"}, {"sse4", "SSE4"},
+  };
+
+  std::vector<std::string> features;
+  for (const auto& feature : kFeatures) {
+    if (cpuinfo.find(feature.flag) != std::string::npos) {
+      features.push_back(feature.name);
+    }
+  }
+  return features;
+}
+
+std::string GetIPAddress(struct ifaddrs* ifaddr) {
+  for (struct ifaddrs* ifa = ifaddr; ifa != NULL; ifa = ifa->ifa_next) {
+    if (ifa->ifa_addr == NULL) continue;
+
+    if (ifa->ifa_addr->sa_family == AF_INET) {
+      char host[NI_MAXHOST];
+      if (getnameinfo(ifa->ifa_addr, sizeof(struct sockaddr_in),
+                      host, NI_MAXHOST, NULL, 0, NI_NUMERICHOST) == 0) {
+        std::string addr = host;
+        if (addr != "127.0.0.1" && addr.find("169.254") != 0) {
+          return addr;
+        }
+      }
+    }
+  }
+  return "unknown";
+}
+
+std::string GetMACAddress(struct ifaddrs* ifaddr) {
+  for (struct ifaddrs* ifa = ifaddr; ifa != NULL; ifa = ifa->ifa_next) {
+    if (ifa->ifa_addr == NULL) continue;
+
+    if (ifa->ifa_addr->sa_family == AF_PACKET) {
+      struct sockaddr_ll* s = (struct sockaddr_ll*)ifa->ifa_addr;
+      if (s->sll_halen == 6) {
+        char mac[18];
+        snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 (unsigned char)s->sll_addr[0],
+                 (unsigned char)s->sll_addr[1],
+                 (unsigned char)s->sll_addr[2],
+                 (unsigned char)s->sll_addr[3],
+                 (unsigned char)s->sll_addr[4],
+                 (unsigned char)s->sll_addr[5]);
+        return mac;
+      }
+    }
+  }
+  return "unknown";
+}
+
+// Parses the aggregate "cpu" line of /proc/stat into busy and total jiffies.
+bool ReadCpuTimes(uint64_t* busy, uint64_t* total) {
+  char buffer[512];
+  if (ReadFileInto("/proc/stat", buffer, sizeof(buffer)) <= 0 ||
+      strncmp(buffer, "cpu ", 4) != 0) {
+    return false;
+  }
+
+  // user nice system idle iowait irq softirq steal
+  uint64_t fields[8] = {0};
+  char* cursor = buffer + 4;
+  for (int i = 0; i < 8; ++i) {
+    char* end = nullptr;
+    fields[i] = strtoull(cursor, &end, 10);
+    if (end == cursor) break;
+    cursor = end;
+  }
+  uint64_t idle = fields[3] + fields[4];
+  *total = 0;
+  for (uint64_t field : fields) {
+    *total += field;
+  }
+  *busy = *total - idle;
+  return true;
+}
+
+}  // namespace
+
+SystemInfo SystemCollector::Collect() const {
+  ScopedCollectTimer timer(StatCollector::kSystem);
+  SystemInfo info;
+
+  std::string machineId = Trim(ReadFile("/etc/machine-id"));
+  if (!machineId.empty()) {
+    info.deviceId = machineId;
+  }
+
+  char hostname[256] = {0};
+  gethostname(hostname, sizeof(hostname) - 1);
+  info.deviceName = hostname;
+
+  struct utsname unameInfo;
+  if (uname(&unameInfo) == 0) {
+    info.systemVersion = unameInfo.release;
+    info.buildNumber = unameInfo.version;
+    info.kernelVersion = unameInfo.release;
+  }
+  return info;
+}
+
+ProcessorInfo ProcessorCollector::Collect() const {
+  return Collect(MaxFrequencyMhz());
+}
+
+ProcessorInfo ProcessorCollector::Collect(int maxFrequencyMhz) const {
+  ScopedCollectTimer timer(StatCollector::kProcessor);
+  ProcessorInfo info;
+
+  struct utsname unameInfo;
+  if (uname(&unameInfo) == 0) {
+    info.architecture = NormalizeArchitecture(unameInfo.machine);
+  }
+  info.coreCount = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+
+  std::string cpuinfo = ReadFile("/proc/cpuinfo");
+  info.maxFrequency = maxFrequencyMhz;
+  if (!cpuinfo.empty()) {
+    std::string freq = FindCpuInfoValue(cpuinfo, "cpu MHz");
+    if (info.maxFrequency == 0 && !freq.empty()) {
+      info.maxFrequency = static_cast<int>(std::strtod(freq.c_str(), nullptr));
+    }
+    std::string name = FindCpuInfoValue(cpuinfo, "model name");
+    if (!name.empty()) {
+      info.processorName = name;
+    }
+  }
+  info.features = ParseProcessorFeatures(cpuinfo);
+  return info;
+}
+
+CpuTopology ProcessorCollector::CollectTopology() const {
+  ScopedCollectTimer timer(StatCollector::kCpuTopology);
+  CpuTopology topology;
+  topology.onlineCpus = ParseCpuList(ReadFile("/sys/devices/system/cpu/online"));
+  topology.allowedCpus = AllowedCpus();
+  topology.isolatedCpus =
+      ParseCpuList(ReadFile("/sys/devices/system/cpu/isolated"));
+
+  for (int id : ParseCpuList(ReadFile("/sys/devices/system/node/online"))) {
+    std::string directory = "/sys/devices/system/node/node" + std::to_string(id);
+    NumaNode node;
+    node.id = id;
+    node.cpus = ParseCpuList(ReadFile(directory + "/cpulist"));
+
+    // "Node 0 MemTotal:       16314012 kB"
+    std::istringstream meminfo(ReadFile(directory + "/meminfo"));
+    std::string line;
+    while (std::getline(meminfo, line)) {
+      size_t colon = line.find(':');
+      if (colon == std::string::npos) continue;
+      int64_t kb = std::strtoll(line.c_str() + colon + 1, nullptr, 10);
+      if (line.find("MemTotal") != std::string::npos) {
+        node.totalMemory = kb * 1024;
+      } else if (line.find("MemFree") != std::string::npos) {
+        node.freeMemory = kb * 1024;
+      }
+    }
+
+    std::istringstream distances(ReadFile(directory + "/distance"));
+    int distance = 0;
+    while (distances >> distance) {
+      node.distances.push_back(distance);
+    }
+    topology.nodes.push_back(node);
+  }
+
+  if (topology.nodes.empty()) {
+    NumaNode node;
+    node.cpus = topology.onlineCpus;
+    MemoryInfo memory = MemoryCollector().Collect();
+    node.totalMemory = memory.totalPhysicalMemory;
+    node.freeMemory = memory.availablePhysicalMemory;
+    node.distances.push_back(10);
+    topology.nodes.push_back(node);
+  }
+  return topology;
+}
+
+std::vector<int> ProcessorCollector::AllowedCpus() {
+  std::vector<int> cpus;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+  return cpus;
+}
+
+int ProcessorCollector::MaxFrequencyMhz() {
+  const std::string cpuPath = "/sys/devices/system/cpu/";
+  DIR* dir = opendir(cpuPath.c_str());
+  if (dir == nullptr) {
+    return 0;
+  }
+  // Hybrid CPUs have cores with different limits; report the fastest.
+  long maxKhz = 0;
+  while (struct dirent* entry = readdir(dir)) {
+    if (strncmp(entry->d_name, "cpu", 3) != 0 ||
+        !isdigit(static_cast<unsigned char>(entry->d_name[3]))) {
+      continue;
+    }
+    std::string value =
+        ReadFile(cpuPath + entry->d_name + "/cpufreq/cpuinfo_max_freq");
+    maxKhz = std::max(maxKhz, std::strtol(value.c_str(), nullptr, 10));
+  }
+  closedir(dir);
+  return static_cast<int>(maxKhz / 1000);
+}
+
+int ProcessorCollector::CurrentFrequencyMhz() {
+  std::string freq = FindCpuInfoValue(ReadFile("/proc/cpuinfo"), "cpu MHz");
+  return static_cast<int>(std::strtod(freq.c_str(), nullptr));
+}
+
+CpuLoad CpuLoadCollector::Collect() {
+  ScopedCollectTimer timer(StatCollector::kCpuLoad);
+  CpuLoad load;
+  load.coreCount = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+
+  uint64_t busy = 0;
+  uint64_t total = 0;
+  if (!ReadCpuTimes(&busy, &total)) {
+    return load;
+  }
+
+  load.available = true;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (total > lastTotal_ && busy >= lastBusy_) {
+    load.usagePercentage =
+        (busy - lastBusy_) * 100.0 / static_cast<double>(total - lastTotal_);
+  }
+  lastBusy_ = busy;
+  lastTotal_ = total;
+  return load;
+}
+
+MemoryInfo MemoryCollector::Collect() const {
+  ScopedCollectTimer timer(StatCollector::kMemory);
+  MemoryInfo info;
+  struct sysinfo sys;
+  if (sysinfo(&sys) == 0) {
+    info.totalPhysicalMemory = static_cast<int64_t>(sys.totalram) * sys.mem_unit;
+    info.availablePhysicalMemory =
+        static_cast<int64_t>(sys.freeram) * sys.mem_unit;
+  }
+  return info;
+}
+
+StorageInfo StorageCollector::Collect() const {
+  ScopedCollectTimer timer(StatCollector::kStorage);
+  StorageInfo info;
+  struct statvfs stat;
+  if (statvfs("/", &stat) == 0) {
+    info.totalStorageSpace = static_cast<int64_t>(stat.f_blocks) * stat.f_frsize;
+    info.availableStorageSpace =
+        static_cast<int64_t>(stat.f_bavail) * stat.f_frsize;
+  }
+  return info;
+}
+
+DisplayInfo DisplayCollector::Collect() const {
+  ScopedCollectTimer timer(StatCollector::kDisplay);
+  return DisplayInfo();
+}
+
+std::vector<DrmConnectorInfo> DisplayCollector::CollectConnectors() const {
+  std::vector<DrmConnectorInfo> connectors;
+  const std::string drmPath = "/sys/class/drm/";
+  DIR* dir = opendir(drmPath.c_str());
+  if (dir == nullptr) {
+    return connectors;
+  }
+
+  while (struct dirent* entry = readdir(dir)) {
+    // Connectors are named "card<N>-<connector>"; skip cards and render nodes.
+    std::string entryName = entry->d_name;
+    size_t dash = entryName.find('-');
+    if (entryName.compare(0, 4, "card") != 0 || dash == std::string::npos) {
+      continue;
+    }
+
+    DrmConnectorInfo connector;
+    connector.name = entryName.substr(dash + 1);
+    std::string path = drmPath + entryName;
+    connector.connected = Trim(ReadFile(path + "/status")) == "connected";
+    std::string edid = ReadFile(path + "/edid");
+    connector.hasEdid =
+        ParseEdid(reinterpret_cast<const uint8_t*>(edid.data()), edid.size(),
+                  &connector.edid);
+    connectors.push_back(std::move(connector));
+  }
+  closedir(dir);
+  return connectors;
+}
+
+void DisplayCollector::ApplyEdid(
+    const std::vector<DrmConnectorInfo>& connectors, int monitorCount,
+    MonitorInfo* monitor) {
+  const DrmConnectorInfo* match = nullptr;
+  const DrmConnectorInfo* productMatch = nullptr;
+  int productMatchCount = 0;
+  const DrmConnectorInfo* onlyConnected = nullptr;
+  int connectedCount = 0;
+  for (const auto& connector : connectors) {
+    if (!connector.hasEdid) continue;
+    if (connector.name == monitor->name || connector.name == monitor->model) {
+      match = &connector;
+      break;
+    }
+    if (!monitor->model.empty() &&
+        connector.edid.productName == monitor->model) {
+      productMatch = &connector;
+      ++productMatchCount;
+    }
+    if (connector.connected) {
+      onlyConnected = &connector;
+      ++connectedCount;
+    }
+  }
+  // Identical monitors share a product name, so it only identifies the
+  // connector if no other one has it.
+  if (match == nullptr && productMatchCount == 1) {
+    match = productMatch;
+  }
+  // With several monitors an unmatched one can't be told apart from the
+  // others, and guessing would give two monitors the same EDID.
+  if (match == nullptr && connectedCount == 1 && monitorCount == 1) {
+    match = onlyConnected;
+  }
+  if (match == nullptr) {
+    return;
+  }
+
+  const EdidInfo& edid = match->edid;
+  monitor->name = match->name;
+  if (monitor->manufacturer.empty()) {
+    monitor->manufacturer = edid.manufacturerId;
+  }
+  if (monitor->model.empty() || monitor->model == match->name) {
+    monitor->model = edid.productName;
+  }
+  if (monitor->widthMm == 0 && monitor->heightMm == 0) {
+    monitor->widthMm = edid.widthCm * 10;
+    monitor->heightMm = edid.heightCm * 10;
+  }
+  monitor->isHdr = edid.hdr;
+  monitor->maxLuminance = edid.maxLuminance;
+  monitor->bitDepth = edid.bitDepth;
+}
+
+DisplayInfo DisplayCollector::Summarize(const MonitorInfo& monitor) {
+  DisplayInfo info;
+  info.screenWidth = monitor.width * monitor.scaleFactor;
+  info.screenHeight = monitor.height * monitor.scaleFactor;
+  info.pixelDensity = monitor.scaleFactor;
+  if (monitor.refreshRate > 0) {
+    info.refreshRate = monitor.refreshRate;
+  }
+  // Projectors and some virtual displays report no physical size.
+  double diagonalMm = std::hypot(monitor.widthMm, monitor.heightMm);
+  if (diagonalMm > 0) {
+    info.screenSizeInches = diagonalMm / 25.4;
+  }
+  info.orientation = monitor.width >= monitor.height ? "landscape" : "portrait";
+  info.isHdr = monitor.isHdr;
+  return info;
+}
+
+GpuCollector::GpuCollector(std::string sysfsRoot)
+    : sysfsRoot_(std::move(sysfsRoot)) {}
+
+std::vector<GpuInfo> GpuCollector::Collect(bool refresh) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool hit = cached_ && !refresh;
+  RecordCacheLookup(StatCache::kGpus, hit);
+  if (!hit) {
+    ScopedCollectTimer timer(StatCollector::kGpus);
+    gpus_ = Enumerate(sysfsRoot_);
+    cached_ = true;
+  }
+  return gpus_;
+}
+
+std::vector<GpuInfo> GpuCollector::Enumerate(const std::string& sysfsRoot) {
+  std::vector<GpuInfo> gpus;
+  const std::string drmPath = sysfsRoot + "/class/drm/";
+  DIR* dir = opendir(drmPath.c_str());
+  if (dir == nullptr) {
+    return gpus;
+  }
+
+  while (struct dirent* entry = readdir(dir)) {
+    // Devices are named "card<N>"; skip connectors and render nodes.
+    std::string entryName = entry->d_name;
+    if (entryName.compare(0, 4, "card") != 0 || entryName.size() == 4 ||
+        entryName.find_first_not_of("0123456789", 4) != std::string::npos) {
+      continue;
+    }
+
+    GpuInfo gpu;
+    gpu.card = entryName;
+    std::string cardPath = drmPath + entryName;
+    std::string devicePath = cardPath + "/device";
+
+    // DRIVER=amdgpu, PCI_ID=1002:73BF, PCI_SLOT_NAME=0000:03:00.0
+    std::istringstream uevent(ReadFile(devicePath + "/uevent"));
+    std::string line;
+    while (std::getline(uevent, line)) {
+      size_t equals = line.find('=');
+      if (equals == std::string::npos) continue;
+      std::string key = line.substr(0, equals);
+      std::string value = line.substr(equals + 1);
+      if (key == "DRIVER") {
+        gpu.driver = value;
+      } else if (key == "PCI_ID") {
+        char* end = nullptr;
+        gpu.pciVendorId = static_cast<int>(strtol(value.c_str(), &end, 16));
+        if (*end == ':') {
+          gpu.pciDeviceId = static_cast<int>(strtol(end + 1, nullptr, 16));
+        }
+      } else if (key == "PCI_SLOT_NAME") {
+        gpu.pciSlot = value;
+      }
+    }
+    gpu.isBootVga = Trim(ReadFile(devicePath + "/boot_vga")) == "1";
+    gpu.vramTotal =
+        std::strtoll(ReadFile(devicePath + "/mem_info_vram_total").c_str(),
+                     nullptr, 10);
+
+    // i915 exposes the GT frequency on the card; amdgpu lists DPM levels
+    // such as "1: 1800Mhz *" with the current one starred.
+    std::string current = ReadFile(cardPath + "/gt_cur_freq_mhz");
+    if (!current.empty()) {
+      gpu.currentClockMhz = std::atoi(current.c_str());
+      gpu.maxClockMhz = std::atoi(ReadFile(cardPath + "/gt_max_freq_mhz").c_str());
+    } else {
+      std::istringstream levels(ReadFile(devicePath + "/pp_dpm_sclk"));
+      while (std::getline(levels, line)) {
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) continue;
+        int mhz = std::atoi(line.c_str() + colon + 1);
+        gpu.maxClockMhz = std::max(gpu.maxClockMhz, mhz);
+        if (line.find('*') != std::string::npos) {
+          gpu.currentClockMhz = mhz;
+        }
+      }
+    }
+
+    // The device's drm directory lists its card and render node.
+    DIR* nodes = opendir((devicePath + "/drm").c_str());
+    if (nodes != nullptr) {
+      while (struct dirent* node = readdir(nodes)) {
+        if (strncmp(node->d_name, "renderD", 7) == 0) {
+          gpu.renderNode = std::string("/dev/dri/") + node->d_name;
+        }
+      }
+      closedir(nodes);
+    }
+    gpus.push_back(std::move(gpu));
+  }
+  closedir(dir);
+
+  std::sort(gpus.begin(), gpus.end(), [](const GpuInfo& a, const GpuInfo& b) {
+    return std::atoi(a.card.c_str() + 4) < std::atoi(b.card.c_str() + 4);
+  });
+  return gpus;
+}
+
+SecurityInfo SecurityCollector::Collect() const {
+  ScopedCollectTimer timer(StatCollector::kSecurity);
+  return SecurityInfo();
+}
+
+BatteryInfo BatteryCollector::Collect() const {
+  ScopedCollectTimer timer(StatCollector::kBattery);
+  std::string capacity = ReadFile(CapacityPath());
+  if (capacity.empty()) {
+    // No battery (desktop)
+    return BatteryInfo();
+  }
+  return Parse(capacity.c_str(), ReadFile(StatusPath()).c_str());
+}
+
+const char* BatteryCollector::CapacityPath() {
+  return "/sys/class/power_supply/BAT0/capacity";
+}
+
+const char* BatteryCollector::StatusPath() {
+  return "/sys/class/power_supply/BAT0/status";
+}
+
+BatteryInfo BatteryCollector::Parse(const char* capacity, const char* status) {
+  BatteryInfo info;
+  if (capacity[0] == '\0') {
+    return info;
+  }
+
+  info.present = true;
+  info.batteryLevel = std::atoi(capacity);
+  if (status[0] != '\0') {
+    if (strstr(status, "Charging") != nullptr) {
+      info.chargingStatus = "charging";
+    } else if (strstr(status, "Full") != nullptr) {
+      info.chargingStatus = "full";
+    } else {
+      info.chargingStatus = "discharging";
+    }
+  }
+  return info;
+}
+
+SensorInfo SensorCollector::Collect() const {
+  ScopedCollectTimer timer(StatCollector::kSensor);
+  SensorInfo info;
+  // Check for available sensors in /sys/bus/iio/devices
+  info.availableSensors.push_back("accelerometer");  // If available
+  return info;
+}
+
+NetworkInfo NetworkCollector::Collect() const {
+  ScopedCollectTimer timer(StatCollector::kNetwork);
+  NetworkInfo info;
+  struct ifaddrs* ifaddr;
+  if (getifaddrs(&ifaddr) == 0) {
+    info.ipAddress = GetIPAddress(ifaddr);
+    info.macAddress = GetMACAddress(ifaddr);
+    freeifaddrs(ifaddr);
+  }
+  return info;
+}
+
+}  // namespace flutter_device_info_plus
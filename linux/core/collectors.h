@@ -0,0 +1,150 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_COLLECTORS_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_COLLECTORS_H_
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "device_info_types.h"
+#include "edid.h"
+
+namespace flutter_device_info_plus {
+
+// Each collector reads one slice of device state from procfs, sysfs or libc.
+// Collectors with a const Collect() keep no state and may be called from any
+// thread. The others (CpuLoadCollector, GpuCollector) remember results
+// between calls and are made thread-safe with their own lock.
+
+class SystemCollector {
+ public:
+  SystemInfo Collect() const;
+};
+
+class ProcessorCollector {
+ public:
+  ProcessorInfo Collect() const;
+  // Like Collect(), with |maxFrequencyMhz| already read by MaxFrequencyMhz().
+  ProcessorInfo Collect(int maxFrequencyMhz) const;
+
+  // Reads NUMA nodes, the affinity mask and isolated CPUs.
+  CpuTopology CollectTopology() const;
+
+  // CPUs the calling thread may run on.
+  static std::vector<int> AllowedCpus();
+
+  // Highest cpuinfo_max_freq of any CPU in MHz, or 0 without cpufreq (e.g.
+  // in most VMs).
+  static int MaxFrequencyMhz();
+
+  // Current clock of the first CPU from /proc/cpuinfo in MHz, which
+  // Collect() reports as maxFrequency when MaxFrequencyMhz() is unknown.
+  static int CurrentFrequencyMhz();
+};
+
+// Computes CPU utilisation from /proc/stat. Unlike the other collectors this
+// one is stateful: each Collect() reports the load since the previous call
+// (or since boot for the first one). Thread-safe and allocation-free.
+class CpuLoadCollector {
+ public:
+  CpuLoad Collect();
+
+ private:
+  std::mutex mutex_;
+  uint64_t lastBusy_ = 0;
+  uint64_t lastTotal_ = 0;
+};
+
+class MemoryCollector {
+ public:
+  MemoryInfo Collect() const;
+};
+
+class StorageCollector {
+ public:
+  StorageInfo Collect() const;
+};
+
+// A DRM connector from /sys/class/drm, e.g. card0-eDP-1.
+struct DrmConnectorInfo {
+  // Connector name without the card prefix, e.g. "eDP-1".
+  std::string name;
+  bool connected = false;
+  bool hasEdid = false;
+  EdidInfo edid;
+};
+
+// Monitor geometry needs a windowing system, so the plugin enumerates
+// monitors through GDK; this collector provides the parts that don't.
+class DisplayCollector {
+ public:
+  // Fixed approximate values used when no monitor can be enumerated.
+  DisplayInfo Collect() const;
+
+  // Lists DRM connectors and parses their EDID.
+  std::vector<DrmConnectorInfo> CollectConnectors() const;
+
+  // Fills the EDID-derived fields of |monitor| from the matching connector,
+  // found by connector name, then by EDID product name if exactly one
+  // connector has it. If neither matches and the windowing system reports
+  // |monitorCount| == 1, the only connected display is used.
+  static void ApplyEdid(const std::vector<DrmConnectorInfo>& connectors,
+                        int monitorCount, MonitorInfo* monitor);
+
+  // Describes |monitor| in the single-display form used by getDeviceInfo.
+  static DisplayInfo Summarize(const MonitorInfo& monitor);
+};
+
+// Lists DRM devices (GPUs and display controllers) with their driver, PCI
+// ids, VRAM, clocks and render node. The inventory only changes on hotplug,
+// so it is cached; pass |refresh| to re-read it. Returns an empty list on
+// machines without DRM devices. Thread-safe.
+class GpuCollector {
+ public:
+  // |sysfsRoot| is where sysfs is mounted; tests point it at a fixture tree.
+  explicit GpuCollector(std::string sysfsRoot = "/sys");
+
+  std::vector<GpuInfo> Collect(bool refresh = false);
+
+ private:
+  static std::vector<GpuInfo> Enumerate(const std::string& sysfsRoot);
+
+  const std::string sysfsRoot_;
+
+  std::mutex mutex_;
+  bool cached_ = false;
+  std::vector<GpuInfo> gpus_;
+};
+
+class SecurityCollector {
+ public:
+  SecurityInfo Collect() const;
+};
+
+class BatteryCollector {
+ public:
+  BatteryInfo Collect() const;
+
+  // Files Collect() reads, for callers that poll them through a
+  // BatchReader.
+  static const char* CapacityPath();
+  static const char* StatusPath();
+
+  // Builds the result from the contents of CapacityPath() and StatusPath().
+  // An empty |capacity| means there is no battery.
+  static BatteryInfo Parse(const char* capacity, const char* status);
+};
+
+class SensorCollector {
+ public:
+  SensorInfo Collect() const;
+};
+
+class NetworkCollector {
+ public:
+  NetworkInfo Collect() const;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_COLLECTORS_H_
@@ -0,0 +1,212 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_DEVICE_INFO_TYPES_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_DEVICE_INFO_TYPES_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace flutter_device_info_plus {
+
+// Plain data produced by the collectors. None of these types depend on
+// Flutter or GLib, so they can be encoded by any front end (FlValue, JSON...).
+
+struct SystemInfo {
+  std::string deviceId = "unknown";
+  std::string deviceName;
+  std::string manufacturer = "Unknown";
+  std::string model = "Linux PC";
+  std::string brand = "Linux";
+  std::string operatingSystem = "Linux";
+  std::string systemVersion;
+  std::string buildNumber;
+  std::string kernelVersion;
+};
+
+struct ProcessorInfo {
+  std::string architecture;
+  int coreCount = 0;
+  int maxFrequency = 0;
+  std::string processorName = "Unknown Processor";
+  std::vector<std::string> features;
+};
+
+// A NUMA node from /sys/devices/system/node.
+struct NumaNode {
+  int id = 0;
+  std::vector<int> cpus;
+  int64_t totalMemory = 0;
+  int64_t freeMemory = 0;
+  // Relative access cost from this node to each node, indexed by position
+  // in CpuTopology::nodes (10 = local).
+  std::vector<int> distances;
+};
+
+// What a thread placement policy needs to know about the CPUs.
+struct CpuTopology {
+  std::vector<int> onlineCpus;
+  // CPUs this process may run on (sched_getaffinity).
+  std::vector<int> allowedCpus;
+  // CPUs removed from the scheduler with isolcpus=.
+  std::vector<int> isolatedCpus;
+  // A single node covering every online CPU on non-NUMA kernels.
+  std::vector<NumaNode> nodes;
+};
+
+struct CpuLoad {
+  // False if /proc/stat couldn't be read.
+  bool available = false;
+  // Busy time across all cores as a percentage (0-100).
+  double usagePercentage = 0.0;
+  int coreCount = 0;
+};
+
+struct MemoryInfo {
+  int64_t totalPhysicalMemory = 0;
+  int64_t availablePhysicalMemory = 0;
+
+  double UsagePercentage() const {
+    return totalPhysicalMemory > 0
+               ? ((totalPhysicalMemory - availablePhysicalMemory) * 100.0 /
+                  totalPhysicalMemory)
+               : 0.0;
+  }
+};
+
+struct StorageInfo {
+  int64_t totalStorageSpace = 0;
+  int64_t availableStorageSpace = 0;
+
+  int64_t UsedStorageSpace() const {
+    return totalStorageSpace - availableStorageSpace;
+  }
+};
+
+struct DisplayInfo {
+  int screenWidth = 1920;
+  int screenHeight = 1080;
+  double pixelDensity = 1.0;
+  double refreshRate = 60.0;
+  double screenSizeInches = 24.0;
+  std::string orientation = "landscape";
+  bool isHdr = false;
+};
+
+// A monitor as reported by the windowing system, enriched with its EDID.
+struct MonitorInfo {
+  // Connector name such as "eDP-1" when known, otherwise the model.
+  std::string name;
+  std::string manufacturer;
+  std::string model;
+  // Geometry in logical pixels.
+  int x = 0;
+  int y = 0;
+  int width = 0;
+  int height = 0;
+  int scaleFactor = 1;
+  // Refresh rate in Hz, 0 if unknown.
+  double refreshRate = 0.0;
+  int widthMm = 0;
+  int heightMm = 0;
+  bool isPrimary = false;
+  bool isHdr = false;
+  // Desired content max luminance in cd/m², 0 if unknown.
+  double maxLuminance = 0.0;
+  // Bits per color channel, 0 if unknown.
+  int bitDepth = 0;
+};
+
+// An io.max (or v1 blkio throttle) entry for one block device. -1 means
+// unlimited.
+struct IoLimit {
+  // "major:minor" of the block device.
+  std::string device;
+  int64_t readBps = -1;
+  int64_t writeBps = -1;
+  int64_t readIops = -1;
+  int64_t writeIops = -1;
+};
+
+// The resources actually available to this process once cgroup limits and
+// CPU affinity are taken into account.
+struct ResourceLimits {
+  // 2 for a pure cgroup v2 hierarchy, 1 for v1 or hybrid, 0 if unknown.
+  int cgroupVersion = 0;
+  // Path of this process's cgroup, as listed in /proc/self/cgroup.
+  std::string cgroupPath;
+  int onlineCpuCount = 0;
+  // CPUs this process may run on (sched_getaffinity).
+  std::vector<int> allowedCpus;
+  // cpuset.cpus.effective, empty if unknown.
+  std::vector<int> cpusetCpus;
+  // CPU bandwidth quota in cores across the hierarchy, 0 if unlimited.
+  double cpuQuota = 0.0;
+  // Useful parallelism: allowed CPUs capped by the rounded-up quota.
+  int effectiveCpuCount = 0;
+  // Memory ceiling in bytes across the hierarchy, -1 if unlimited.
+  int64_t memoryLimit = -1;
+  // Physical memory capped by the memory ceiling.
+  int64_t effectiveMemory = 0;
+  std::vector<IoLimit> ioLimits;
+};
+
+// A DRM device from /sys/class/drm/card<N>.
+struct GpuInfo {
+  // "card0".
+  std::string card;
+  // Kernel driver, e.g. "amdgpu", "i915", "nouveau", "vc4" or "simpledrm".
+  std::string driver;
+  // PCI ids, 0 for platform (non-PCI) devices such as most ARM GPUs.
+  int pciVendorId = 0;
+  int pciDeviceId = 0;
+  // "0000:03:00.0", empty for platform devices.
+  std::string pciSlot;
+  // Whether the firmware used this device for the boot console.
+  bool isBootVga = false;
+  // Dedicated video memory in bytes, 0 if unknown or shared.
+  int64_t vramTotal = 0;
+  // Core clock in MHz, 0 if the driver doesn't report it.
+  int currentClockMhz = 0;
+  int maxClockMhz = 0;
+  // "/dev/dri/renderD128", empty if the device can't render (e.g. a
+  // display-only or firmware framebuffer driver).
+  std::string renderNode;
+};
+
+struct SecurityInfo {
+  bool isDeviceSecure = true;
+  bool hasFingerprint = false;
+  bool hasFaceUnlock = false;
+  bool screenLockEnabled = true;
+  std::string encryptionStatus = "unknown";
+};
+
+struct BatteryInfo {
+  // False on machines without a battery (desktops); the other fields are
+  // meaningless in that case.
+  bool present = false;
+  int batteryLevel = 0;
+  std::string chargingStatus = "unknown";
+  std::string batteryHealth = "good";
+  int batteryCapacity = 0;
+  double batteryVoltage = 0.0;
+  double batteryTemperature = 0.0;
+};
+
+struct SensorInfo {
+  std::vector<std::string> availableSensors;
+};
+
+struct NetworkInfo {
+  std::string connectionType = "ethernet";
+  std::string networkSpeed = "Unknown";
+  std::string ipAddress = "unknown";
+  std::string macAddress = "unknown";
+
+  bool IsConnected() const {
+    return !ipAddress.empty() && ipAddress != "unknown";
+  }
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_DEVICE_INFO_TYPES_H_
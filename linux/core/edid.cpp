@@ -0,0 +1,128 @@
+#include "edid.h"
+
+#include <cmath>
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+constexpr size_t kBlockSize = 128;
+constexpr uint8_t kHeader[8] = {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+
+// Offsets into the base block.
+constexpr size_t kManufacturerOffset = 8;
+constexpr size_t kProductCodeOffset = 10;
+constexpr size_t kVersionOffset = 18;
+constexpr size_t kInputOffset = 20;
+constexpr size_t kWidthCmOffset = 21;
+constexpr size_t kHeightCmOffset = 22;
+constexpr size_t kDescriptorOffset = 54;
+constexpr size_t kDescriptorSize = 18;
+constexpr size_t kExtensionCountOffset = 126;
+
+constexpr uint8_t kMonitorNameTag = 0xFC;
+constexpr uint8_t kCtaExtensionTag = 0x02;
+constexpr uint8_t kCtaExtendedTag = 7;
+constexpr uint8_t kHdrStaticMetadataTag = 6;
+constexpr uint8_t kEotfPq = 1 << 2;
+constexpr uint8_t kEotfHlg = 1 << 3;
+
+bool ChecksumValid(const uint8_t* block) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < kBlockSize; ++i) {
+    sum = static_cast<uint8_t>(sum + block[i]);
+  }
+  return sum == 0;
+}
+
+void ParseDescriptor(const uint8_t* descriptor, EdidInfo* out) {
+  // Display descriptors start with a zero pixel clock.
+  if (descriptor[0] != 0 || descriptor[1] != 0 ||
+      descriptor[3] != kMonitorNameTag) {
+    return;
+  }
+  std::string name;
+  for (size_t i = 5; i < kDescriptorSize && descriptor[i] != 0x0A; ++i) {
+    name += static_cast<char>(descriptor[i]);
+  }
+  size_t end = name.find_last_not_of(' ');
+  out->productName = end == std::string::npos ? "" : name.substr(0, end + 1);
+}
+
+void ParseCtaExtension(const uint8_t* block, EdidInfo* out) {
+  // Data blocks live between byte 4 and the first detailed timing.
+  size_t end = block[2];
+  if (end < 4 || end > kBlockSize - 1) {
+    return;
+  }
+  for (size_t i = 4; i < end;) {
+    uint8_t tag = block[i] >> 5;
+    size_t length = block[i] & 0x1F;
+    const uint8_t* payload = block + i + 1;
+    if (i + 1 + length > end) {
+      break;
+    }
+    if (tag == kCtaExtendedTag && length >= 3 &&
+        payload[0] == kHdrStaticMetadataTag) {
+      uint8_t eotfs = payload[1];
+      out->hdr = (eotfs & (kEotfPq | kEotfHlg)) != 0;
+      if (length >= 4 && payload[3] != 0) {
+        // CTA-861-G: 50 * 2^(CV / 32) cd/m².
+        out->maxLuminance = 50.0 * std::pow(2.0, payload[3] / 32.0);
+      }
+    }
+    i += 1 + length;
+  }
+}
+
+}  // namespace
+
+bool ParseEdid(const uint8_t* data, size_t size, EdidInfo* out) {
+  if (size < kBlockSize) {
+    return false;
+  }
+  for (size_t i = 0; i < sizeof(kHeader); ++i) {
+    if (data[i] != kHeader[i]) {
+      return false;
+    }
+  }
+  if (!ChecksumValid(data)) {
+    return false;
+  }
+
+  *out = EdidInfo();
+  uint16_t vendor = static_cast<uint16_t>(data[kManufacturerOffset] << 8 |
+                                          data[kManufacturerOffset + 1]);
+  for (int shift = 10; shift >= 0; shift -= 5) {
+    out->manufacturerId += static_cast<char>('A' - 1 + ((vendor >> shift) & 0x1F));
+  }
+  out->productCode = static_cast<uint16_t>(data[kProductCodeOffset] |
+                                           data[kProductCodeOffset + 1] << 8);
+  out->widthCm = data[kWidthCmOffset];
+  out->heightCm = data[kHeightCmOffset];
+
+  // EDID 1.4 digital inputs encode the color depth in bits 6-4.
+  uint8_t input = data[kInputOffset];
+  if (data[kVersionOffset] == 1 && data[kVersionOffset + 1] >= 4 &&
+      (input & 0x80) != 0) {
+    int depth = (input >> 4) & 0x07;
+    if (depth >= 1 && depth <= 6) {
+      out->bitDepth = 4 + depth * 2;
+    }
+  }
+
+  for (size_t i = 0; i < 4; ++i) {
+    ParseDescriptor(data + kDescriptorOffset + i * kDescriptorSize, out);
+  }
+
+  size_t extensions = data[kExtensionCountOffset];
+  for (size_t i = 1; i <= extensions && (i + 1) * kBlockSize <= size; ++i) {
+    const uint8_t* block = data + i * kBlockSize;
+    if (block[0] == kCtaExtensionTag && ChecksumValid(block)) {
+      ParseCtaExtension(block, out);
+    }
+  }
+  return true;
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,33 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_EDID_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_EDID_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace flutter_device_info_plus {
+
+// The parts of a monitor's EDID that matter to renderers.
+struct EdidInfo {
+  // Three letter PNP vendor ID, e.g. "DEL".
+  std::string manufacturerId;
+  uint16_t productCode = 0;
+  // Monitor name descriptor, empty if the EDID has none.
+  std::string productName;
+  int widthCm = 0;
+  int heightCm = 0;
+  // Bits per color channel, 0 if unknown (EDID < 1.4 or analog input).
+  int bitDepth = 0;
+  // True if the CTA-861 HDR static metadata block advertises PQ or HLG.
+  bool hdr = false;
+  // Desired content max luminance in cd/m², 0 if not advertised.
+  double maxLuminance = 0.0;
+};
+
+// Parses a raw EDID blob (base block plus any extension blocks). Returns
+// false if it isn't a valid EDID.
+bool ParseEdid(const uint8_t* data, size_t size, EdidInfo* out);
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_EDID_H_
@@ -0,0 +1,83 @@
+#include "file_util.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "stats.h"
+
+namespace flutter_device_info_plus {
+
+std::string ReadFile(const std::string& path) {
+  std::ifstream file(path);
+  if (file.is_open()) {
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string contents = buffer.str();
+    RecordFileRead(contents.size());
+    return contents;
+  }
+  return "";
+}
+
+long ReadFileInto(const char* path, char* buffer, size_t size) {
+  if (size == 0) {
+    return -1;
+  }
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return -1;
+  }
+  size_t total = 0;
+  while (total < size - 1) {
+    ssize_t n = read(fd, buffer + total, size - 1 - total);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      close(fd);
+      return -1;
+    }
+    if (n == 0) break;
+    total += static_cast<size_t>(n);
+  }
+  close(fd);
+  buffer[total] = '\0';
+  RecordFileRead(total);
+  return static_cast<long>(total);
+}
+
+std::vector<int> ParseCpuList(const std::string& list) {
+  std::vector<int> cpus;
+  std::stringstream stream(Trim(list));
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) continue;
+    char* end = nullptr;
+    long first = std::strtol(range.c_str(), &end, 10);
+    long last = first;
+    if (*end == '-') {
+      last = std::strtol(end + 1, nullptr, 10);
+    }
+    for (long cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(static_cast<int>(cpu));
+    }
+  }
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+std::string Trim(const std::string& value) {
+  const char* whitespace = " \t\n\r";
+  size_t start = value.find_first_not_of(whitespace);
+  if (start == std::string::npos) {
+    return "";
+  }
+  size_t end = value.find_last_not_of(whitespace);
+  return value.substr(start, end - start + 1);
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,26 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_FILE_UTIL_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_FILE_UTIL_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace flutter_device_info_plus {
+
+// Reads the whole file at |path|. Returns an empty string if it can't be read.
+std::string ReadFile(const std::string& path);
+
+// Reads up to |size| - 1 bytes of the file at |path| into |buffer| and
+// NUL-terminates it. Doesn't allocate, for use on hot paths. Returns the
+// number of bytes read, or -1 on failure.
+long ReadFileInto(const char* path, char* buffer, size_t size);
+
+// Parses a kernel CPU list such as "0-3,8,10-11" into sorted CPU numbers.
+std::vector<int> ParseCpuList(const std::string& list);
+
+// Returns |value| without leading and trailing whitespace.
+std::string Trim(const std::string& value);
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_FILE_UTIL_H_
@@ -0,0 +1,307 @@
+#include "hardware_profile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "collectors.h"
+#include "file_util.h"
+#include "stats.h"
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+// File layout, little-endian as written by the host:
+//   char     magic[4] = "FDHP"
+//   uint32_t version
+//   uint32_t payloadSize
+//   uint32_t payloadChecksum (FNV-1a)
+//   payload: key strings (machine-id, uname release, version, machine),
+//            then the profile fields in declaration order.
+// Strings are a uint32_t length followed by the bytes; integers are int32_t.
+constexpr char kMagic[4] = {'F', 'D', 'H', 'P'};
+constexpr size_t kHeaderSize = 16;
+
+uint32_t Fnv1a(const char* data, size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<uint8_t>(data[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// The values a profile is only valid for.
+struct ProfileKey {
+  std::string machineId;
+  std::string release;
+  std::string version;
+  std::string machine;
+};
+
+ProfileKey CurrentKey() {
+  ProfileKey key;
+  key.machineId = Trim(ReadFile("/etc/machine-id"));
+  struct utsname unameInfo;
+  if (uname(&unameInfo) == 0) {
+    key.release = unameInfo.release;
+    key.version = unameInfo.version;
+    key.machine = unameInfo.machine;
+  }
+  return key;
+}
+
+class Writer {
+ public:
+  void Int(int32_t value) { Append(&value, sizeof(value)); }
+  void String(const std::string& value) {
+    uint32_t size = static_cast<uint32_t>(value.size());
+    Append(&size, sizeof(size));
+    Append(value.data(), value.size());
+  }
+  const std::vector<char>& data() const { return data_; }
+
+ private:
+  void Append(const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    data_.insert(data_.end(), bytes, bytes + size);
+  }
+
+  std::vector<char> data_;
+};
+
+// Bounds-checked reads over the mapped payload. Any overrun fails the
+// whole load.
+class Reader {
+ public:
+  Reader(const char* data, size_t size) : data_(data), size_(size) {}
+
+  bool Int(int32_t* value) { return Copy(value, sizeof(*value)); }
+  bool String(std::string* value) {
+    uint32_t size = 0;
+    if (!Copy(&size, sizeof(size)) || size > size_ - offset_) {
+      return false;
+    }
+    value->assign(data_ + offset_, size);
+    offset_ += size;
+    return true;
+  }
+  bool AtEnd() const { return offset_ == size_; }
+
+ private:
+  bool Copy(void* out, size_t size) {
+    if (size > size_ - offset_) {
+      return false;
+    }
+    memcpy(out, data_ + offset_, size);
+    offset_ += size;
+    return true;
+  }
+
+  const char* data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+bool ParsePayload(Reader* reader, const ProfileKey& key,
+                  HardwareProfile* profile) {
+  ProfileKey stored;
+  if (!reader->String(&stored.machineId) || !reader->String(&stored.release) ||
+      !reader->String(&stored.version) || !reader->String(&stored.machine) ||
+      stored.machineId != key.machineId || stored.release != key.release ||
+      stored.version != key.version || stored.machine != key.machine) {
+    return false;
+  }
+
+  SystemInfo& system = profile->system;
+  ProcessorInfo& processor = profile->processor;
+  int32_t coreCount = 0;
+  int32_t maxFrequency = 0;
+  int32_t featureCount = 0;
+  if (!reader->String(&system.deviceId) ||
+      !reader->String(&system.manufacturer) || !reader->String(&system.model) ||
+      !reader->String(&system.brand) ||
+      !reader->String(&system.operatingSystem) ||
+      !reader->String(&system.systemVersion) ||
+      !reader->String(&system.buildNumber) ||
+      !reader->String(&system.kernelVersion) ||
+      !reader->String(&processor.architecture) || !reader->Int(&coreCount) ||
+      !reader->Int(&maxFrequency) || !reader->String(&processor.processorName) ||
+      !reader->Int(&featureCount) || featureCount < 0) {
+    return false;
+  }
+  processor.coreCount = coreCount;
+  processor.maxFrequency = maxFrequency;
+  processor.features.resize(static_cast<size_t>(featureCount));
+  for (auto& feature : processor.features) {
+    if (!reader->String(&feature)) {
+      return false;
+    }
+  }
+  return reader->AtEnd();
+}
+
+bool MakeDirectories(const std::string& path) {
+  for (size_t slash = path.find('/', 1); slash != std::string::npos;
+       slash = path.find('/', slash + 1)) {
+    if (mkdir(path.substr(0, slash).c_str(), 0700) != 0 && errno != EEXIST) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+std::string DefaultHardwareProfilePath() {
+  std::string directory;
+  const char* cacheHome = getenv("XDG_CACHE_HOME");
+  if (cacheHome != nullptr && cacheHome[0] == '/') {
+    directory = cacheHome;
+  } else {
+    const char* home = getenv("HOME");
+    if (home == nullptr || home[0] == '\0') {
+      return "";
+    }
+    directory = std::string(home) + "/.cache";
+  }
+  return directory + "/flutter_device_info_plus/hardware_profile.bin";
+}
+
+bool LoadHardwareProfile(const std::string& path, HardwareProfile* profile) {
+  if (path.empty()) {
+    return false;
+  }
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(kHeaderSize)) {
+    close(fd);
+    return false;
+  }
+  size_t size = static_cast<size_t>(st.st_size);
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+
+  const char* data = static_cast<const char*>(mapping);
+  uint32_t version = 0;
+  uint32_t payloadSize = 0;
+  uint32_t checksum = 0;
+  memcpy(&version, data + 4, sizeof(version));
+  memcpy(&payloadSize, data + 8, sizeof(payloadSize));
+  memcpy(&checksum, data + 12, sizeof(checksum));
+  const char* payload = data + kHeaderSize;
+
+  bool valid = memcmp(data, kMagic, sizeof(kMagic)) == 0 &&
+               version == kHardwareProfileVersion &&
+               payloadSize == size - kHeaderSize &&
+               Fnv1a(payload, payloadSize) == checksum;
+  if (valid) {
+    HardwareProfile loaded;
+    Reader reader(payload, payloadSize);
+    valid = ParsePayload(&reader, CurrentKey(), &loaded);
+    if (valid) {
+      *profile = std::move(loaded);
+    }
+  }
+  munmap(mapping, size);
+  return valid;
+}
+
+bool SaveHardwareProfile(const std::string& path,
+                         const HardwareProfile& profile) {
+  if (path.empty() || !MakeDirectories(path)) {
+    return false;
+  }
+
+  ProfileKey key = CurrentKey();
+  Writer writer;
+  writer.String(key.machineId);
+  writer.String(key.release);
+  writer.String(key.version);
+  writer.String(key.machine);
+  const SystemInfo& system = profile.system;
+  const ProcessorInfo& processor = profile.processor;
+  writer.String(system.deviceId);
+  writer.String(system.manufacturer);
+  writer.String(system.model);
+  writer.String(system.brand);
+  writer.String(system.operatingSystem);
+  writer.String(system.systemVersion);
+  writer.String(system.buildNumber);
+  writer.String(system.kernelVersion);
+  writer.String(processor.architecture);
+  writer.Int(processor.coreCount);
+  writer.Int(processor.maxFrequency);
+  writer.String(processor.processorName);
+  writer.Int(static_cast<int32_t>(processor.features.size()));
+  for (const auto& feature : processor.features) {
+    writer.String(feature);
+  }
+
+  const std::vector<char>& payload = writer.data();
+  char header[kHeaderSize];
+  uint32_t payloadSize = static_cast<uint32_t>(payload.size());
+  uint32_t checksum = Fnv1a(payload.data(), payload.size());
+  memcpy(header, kMagic, sizeof(kMagic));
+  memcpy(header + 4, &kHardwareProfileVersion, sizeof(uint32_t));
+  memcpy(header + 8, &payloadSize, sizeof(payloadSize));
+  memcpy(header + 12, &checksum, sizeof(checksum));
+
+  // Write a temporary file and rename it so concurrent readers never see a
+  // partial profile.
+  std::string temporary = path + "." + std::to_string(getpid()) + ".tmp";
+  int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                0600);
+  if (fd < 0) {
+    return false;
+  }
+  bool written =
+      write(fd, header, sizeof(header)) == static_cast<ssize_t>(sizeof(header)) &&
+      write(fd, payload.data(), payload.size()) ==
+          static_cast<ssize_t>(payload.size());
+  written = close(fd) == 0 && written;
+  if (!written || rename(temporary.c_str(), path.c_str()) != 0) {
+    unlink(temporary.c_str());
+    return false;
+  }
+  return true;
+}
+
+HardwareProfile LoadOrCollectHardwareProfile(const std::string& path) {
+  HardwareProfile profile;
+  bool hit = LoadHardwareProfile(path, &profile);
+  RecordCacheLookup(StatCache::kHardwareProfile, hit);
+  if (!hit) {
+    profile.system = SystemCollector().Collect();
+    int maxFrequency = ProcessorCollector::MaxFrequencyMhz();
+    profile.processor = ProcessorCollector().Collect(maxFrequency);
+    // Only the cpufreq limit is static; a sampled "cpu MHz" is stored as 0
+    // and read again on every load.
+    HardwareProfile stored = profile;
+    stored.processor.maxFrequency = maxFrequency;
+    SaveHardwareProfile(path, stored);
+  } else if (profile.processor.maxFrequency == 0) {
+    profile.processor.maxFrequency = ProcessorCollector::CurrentFrequencyMhz();
+  }
+
+  char hostname[256] = {0};
+  gethostname(hostname, sizeof(hostname) - 1);
+  profile.system.deviceName = hostname;
+  profile.processor.coreCount = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+  return profile;
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,43 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_HARDWARE_PROFILE_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_HARDWARE_PROFILE_H_
+
+#include <string>
+
+#include "device_info_types.h"
+
+namespace flutter_device_info_plus {
+
+// The parts of SystemInfo and ProcessorInfo that only change with the
+// hardware, the OS installation or the kernel.
+struct HardwareProfile {
+  SystemInfo system;
+  ProcessorInfo processor;
+};
+
+// Bumped whenever the file layout or what the collectors report changes,
+// which invalidates existing profiles.
+constexpr uint32_t kHardwareProfileVersion = 2;
+
+// $XDG_CACHE_HOME/flutter_device_info_plus/hardware_profile.bin, falling
+// back to ~/.cache. Empty if neither is known.
+std::string DefaultHardwareProfilePath();
+
+// Maps the profile at |path| and returns true if it was written by this
+// version for the running machine-id and kernel (uname release and
+// version).
+bool LoadHardwareProfile(const std::string& path, HardwareProfile* profile);
+
+// Writes |profile| to |path| atomically, creating its directory.
+bool SaveHardwareProfile(const std::string& path,
+                         const HardwareProfile& profile);
+
+// Returns the cached profile when it is valid, otherwise collects it and
+// refreshes the cache. The host name and online core count are always
+// read live since they can change at any time. So is maxFrequency on
+// machines without cpufreq, where it is the current (scaled) clock.
+HardwareProfile LoadOrCollectHardwareProfile(
+    const std::string& path = DefaultHardwareProfilePath());
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_HARDWARE_PROFILE_H_
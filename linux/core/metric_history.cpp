@@ -0,0 +1,108 @@
+#include "metric_history.h"
+
+#include <algorithm>
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+struct ResolutionSpec {
+  int64_t bucketMs;
+  size_t capacity;
+};
+
+// 10 minutes at 1 s, 1 hour at 10 s, 24 hours at 1 min.
+constexpr ResolutionSpec kResolutions[] = {
+    {1000, 600},
+    {10000, 360},
+    {60000, 1440},
+};
+
+int64_t FloorDiv(int64_t value, int64_t divisor) {
+  int64_t quotient = value / divisor;
+  return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+}
+
+}  // namespace
+
+MetricHistory::MetricHistory() {
+  for (int metric = 0; metric < static_cast<int>(HistoryMetric::kCount);
+       ++metric) {
+    for (int resolution = 0;
+         resolution < static_cast<int>(HistoryResolution::kCount);
+         ++resolution) {
+      buckets_[metric][resolution].resize(kResolutions[resolution].capacity);
+    }
+  }
+}
+
+int64_t MetricHistory::ResolutionMs(HistoryResolution resolution) {
+  return kResolutions[static_cast<int>(resolution)].bucketMs;
+}
+
+void MetricHistory::Record(HistoryMetric metric, int64_t timestampMs,
+                           double value) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (int resolution = 0;
+       resolution < static_cast<int>(HistoryResolution::kCount); ++resolution) {
+    std::vector<Bucket>& buckets =
+        Buckets(metric, static_cast<HistoryResolution>(resolution));
+    int64_t index = FloorDiv(timestampMs, kResolutions[resolution].bucketMs);
+    Bucket& bucket = buckets[static_cast<size_t>(index) % buckets.size()];
+    if (bucket.index != index) {
+      // The slot holds an older bucket (or none): start over. A sample
+      // older than the slot's bucket is too old to keep.
+      if (bucket.index > index) {
+        continue;
+      }
+      bucket.index = index;
+      bucket.min = value;
+      bucket.max = value;
+      bucket.sum = 0.0;
+      bucket.count = 0;
+    }
+    bucket.min = std::min(bucket.min, value);
+    bucket.max = std::max(bucket.max, value);
+    bucket.sum += value;
+    ++bucket.count;
+  }
+}
+
+std::vector<double> MetricHistory::Query(HistoryMetric metric,
+                                         std::chrono::milliseconds range,
+                                         HistoryResolution resolution,
+                                         int64_t nowMs) const {
+  std::vector<double> result;
+  const int64_t bucketMs = ResolutionMs(resolution);
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::vector<Bucket>& buckets = Buckets(metric, resolution);
+
+  int64_t last = FloorDiv(nowMs, bucketMs);
+  int64_t wanted = std::max<int64_t>(1, (range.count() + bucketMs - 1) / bucketMs);
+  int64_t first =
+      last - std::min<int64_t>(wanted, static_cast<int64_t>(buckets.size())) + 1;
+  result.reserve(static_cast<size_t>(last - first + 1) * kHistoryStride);
+  for (int64_t index = first; index <= last; ++index) {
+    const Bucket& bucket = buckets[static_cast<size_t>(index) % buckets.size()];
+    if (bucket.index != index || bucket.count == 0) {
+      continue;
+    }
+    result.push_back(static_cast<double>(index * bucketMs));
+    result.push_back(bucket.min);
+    result.push_back(bucket.max);
+    result.push_back(bucket.sum / bucket.count);
+  }
+  return result;
+}
+
+std::vector<MetricHistory::Bucket>& MetricHistory::Buckets(
+    HistoryMetric metric, HistoryResolution resolution) {
+  return buckets_[static_cast<int>(metric)][static_cast<int>(resolution)];
+}
+
+const std::vector<MetricHistory::Bucket>& MetricHistory::Buckets(
+    HistoryMetric metric, HistoryResolution resolution) const {
+  return buckets_[static_cast<int>(metric)][static_cast<int>(resolution)];
+}
+
+}  // namespace flutter_device_info_plus
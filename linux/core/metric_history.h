@@ -0,0 +1,81 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_METRIC_HISTORY_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_METRIC_HISTORY_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace flutter_device_info_plus {
+
+enum class HistoryMetric {
+  // Percent (0-100).
+  kCpuUsage,
+  kMemoryUsage,
+  // Bytes.
+  kAvailableMemory,
+  kAvailableStorage,
+  // Percent (0-100).
+  kBatteryLevel,
+  kCount,
+};
+
+enum class HistoryResolution {
+  kOneSecond,
+  kTenSeconds,
+  kOneMinute,
+  kCount,
+};
+
+// Number of doubles per bucket returned by MetricHistory::Query().
+constexpr int kHistoryStride = 4;
+
+// Keeps recent values of each metric as min/max/avg rollups at 1 s, 10 s and
+// 1 min resolution, covering the last 10 minutes, 1 hour and 24 hours
+// respectively. All storage is allocated up front and recording never
+// allocates. Thread-safe.
+class MetricHistory {
+ public:
+  MetricHistory();
+
+  // Disallow copy and assign.
+  MetricHistory(const MetricHistory&) = delete;
+  MetricHistory& operator=(const MetricHistory&) = delete;
+
+  // Adds |value| observed at |timestampMs| (wall clock, ms since the epoch)
+  // to every resolution.
+  void Record(HistoryMetric metric, int64_t timestampMs, double value);
+
+  // Returns the buckets of the last |range| before |nowMs|, oldest first, as
+  // packed [startMs, min, max, avg] quadruples. Buckets without samples are
+  // left out.
+  std::vector<double> Query(HistoryMetric metric,
+                            std::chrono::milliseconds range,
+                            HistoryResolution resolution,
+                            int64_t nowMs) const;
+
+  static int64_t ResolutionMs(HistoryResolution resolution);
+
+ private:
+  struct Bucket {
+    // Start time divided by the resolution; -1 while unused.
+    int64_t index = -1;
+    double min = 0.0;
+    double max = 0.0;
+    double sum = 0.0;
+    uint32_t count = 0;
+  };
+
+  std::vector<Bucket>& Buckets(HistoryMetric metric,
+                               HistoryResolution resolution);
+  const std::vector<Bucket>& Buckets(HistoryMetric metric,
+                                     HistoryResolution resolution) const;
+
+  mutable std::mutex mutex_;
+  std::vector<Bucket> buckets_[static_cast<int>(HistoryMetric::kCount)]
+                              [static_cast<int>(HistoryResolution::kCount)];
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_METRIC_HISTORY_H_
@@ -0,0 +1,152 @@
+#include "sampling_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+// A cheap task is pulled forward if it is due within this fraction of its
+// current interval...
+constexpr int kCoalesceDivisor = 4;
+// ...and at most this fraction of its minimum interval has yet to elapse.
+constexpr int kMinIntervalToleranceDivisor = 10;
+
+}  // namespace
+
+SamplingScheduler::~SamplingScheduler() {
+  Stop();
+}
+
+void SamplingScheduler::Add(std::string name, SamplingPolicy policy,
+                            Task task) {
+  policy.maxInterval = std::max(policy.maxInterval, policy.minInterval);
+  Entry entry;
+  entry.name = std::move(name);
+  entry.policy = policy;
+  entry.task = std::move(task);
+  entry.interval = policy.minInterval;
+  entries_.push_back(std::move(entry));
+}
+
+void SamplingScheduler::Start() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (running_) {
+    return;
+  }
+  running_ = true;
+  RunDue(&lock, true);
+  thread_ = std::thread(&SamplingScheduler::Run, this);
+}
+
+void SamplingScheduler::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  wake_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void SamplingScheduler::Pause() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  paused_ = true;
+}
+
+void SamplingScheduler::Resume() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!paused_) {
+      return;
+    }
+    paused_ = false;
+    resumed_ = true;
+  }
+  wake_.notify_all();
+}
+
+void SamplingScheduler::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (running_) {
+    if (paused_) {
+      wake_.wait(lock, [this] { return !running_ || !paused_; });
+      continue;
+    }
+    if (resumed_) {
+      resumed_ = false;
+      RunDue(&lock, true);
+      continue;
+    }
+    auto interrupted = [this] { return !running_ || paused_ || resumed_; };
+    Clock::time_point wakeup = NextWakeup();
+    if (wakeup == Clock::time_point::max()) {
+      wake_.wait(lock, interrupted);
+      continue;
+    }
+    if (wake_.wait_until(lock, wakeup, interrupted)) {
+      continue;
+    }
+    RunDue(&lock, false);
+  }
+}
+
+void SamplingScheduler::RunDue(std::unique_lock<std::mutex>* lock,
+                               bool force) {
+  Clock::time_point now = Clock::now();
+  std::vector<Entry*> due;
+  for (Entry& entry : entries_) {
+    const auto& minInterval = entry.policy.minInterval;
+    Clock::time_point earliest =
+        entry.lastRun + minInterval - minInterval / kMinIntervalToleranceDivisor;
+    bool overdue = entry.nextRun <= now;
+    bool minElapsed = entry.lastRun + minInterval <= now;
+    bool dueSoon = entry.policy.cost == CollectorCost::kCheap &&
+                   entry.nextRun <= now + entry.interval / kCoalesceDivisor &&
+                   earliest <= now;
+    if (overdue || (force && minElapsed) || dueSoon) {
+      due.push_back(&entry);
+    }
+  }
+  if (due.empty()) {
+    return;
+  }
+
+  // Tasks and the callback run unlocked so Pause() and Stop() stay
+  // responsive. |entries_| is immutable once started.
+  lock->unlock();
+  bool anyChanged = false;
+  std::vector<bool> changed(due.size());
+  for (size_t i = 0; i < due.size(); ++i) {
+    changed[i] = due[i]->task();
+    anyChanged = anyChanged || changed[i];
+  }
+  if (tickCallback_) {
+    tickCallback_(anyChanged);
+  }
+  lock->lock();
+
+  Clock::time_point finished = Clock::now();
+  for (size_t i = 0; i < due.size(); ++i) {
+    Entry* entry = due[i];
+    if (changed[i] || force) {
+      entry->interval = entry->policy.minInterval;
+    } else {
+      entry->interval = std::min(entry->interval * 2, entry->policy.maxInterval);
+    }
+    entry->lastRun = finished;
+    entry->nextRun = finished + entry->interval;
+  }
+}
+
+SamplingScheduler::Clock::time_point SamplingScheduler::NextWakeup() const {
+  Clock::time_point next = Clock::time_point::max();
+  for (const Entry& entry : entries_) {
+    next = std::min(next, entry.nextRun);
+  }
+  return next;
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,103 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_SAMPLING_SCHEDULER_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_SAMPLING_SCHEDULER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flutter_device_info_plus {
+
+enum class CollectorCost {
+  // Reads one small procfs file or makes a single syscall.
+  kCheap,
+  // Enumerates devices or interfaces, or touches a filesystem.
+  kExpensive,
+};
+
+// How often a collector may and should be sampled.
+struct SamplingPolicy {
+  CollectorCost cost = CollectorCost::kCheap;
+  // The collector is never sampled more often than this.
+  std::chrono::milliseconds minInterval{1000};
+  // While the value is stable the interval doubles up to this limit.
+  std::chrono::milliseconds maxInterval{1000};
+};
+
+// Runs many collectors from a single thread with as few wakeups as possible.
+//
+// Every task has its own interval between the policy's min and max. When a
+// task reports no change its interval doubles (backoff); a change resets it
+// to the minimum. On each wakeup every overdue task runs, and tasks that
+// would be due soon after are pulled forward as long as that (almost)
+// respects their minimum interval, so collectors with similar rates share
+// wakeups.
+// Expensive tasks are never pulled forward.
+class SamplingScheduler {
+ public:
+  // Samples the collector and returns whether the value changed
+  // meaningfully since the previous call.
+  using Task = std::function<bool()>;
+  // Called on the scheduler thread after a wakeup that ran at least one
+  // task, with whether any of them reported a change.
+  using TickCallback = std::function<void(bool changed)>;
+
+  SamplingScheduler() = default;
+  ~SamplingScheduler();
+
+  // Disallow copy and assign.
+  SamplingScheduler(const SamplingScheduler&) = delete;
+  SamplingScheduler& operator=(const SamplingScheduler&) = delete;
+
+  // Registers a task. Must be called before Start().
+  void Add(std::string name, SamplingPolicy policy, Task task);
+
+  void SetTickCallback(TickCallback callback) {
+    tickCallback_ = std::move(callback);
+  }
+
+  // Runs every task once on the calling thread, then starts the scheduler
+  // thread.
+  void Start();
+  void Stop();
+
+  // While paused no task runs. Resume() immediately runs every task whose
+  // minimum interval has elapsed and resets the backoff.
+  void Pause();
+  void Resume();
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    std::string name;
+    SamplingPolicy policy;
+    Task task;
+    std::chrono::milliseconds interval{0};
+    Clock::time_point lastRun;
+    Clock::time_point nextRun;
+  };
+
+  void Run();
+  // Runs the due tasks and returns whether anything ran and changed.
+  // Called with |mutex_| held; releases it while tasks run.
+  void RunDue(std::unique_lock<std::mutex>* lock, bool force);
+  Clock::time_point NextWakeup() const;
+
+  std::vector<Entry> entries_;
+  TickCallback tickCallback_;
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool running_ = false;
+  bool paused_ = false;
+  bool resumed_ = false;
+  std::thread thread_;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_SAMPLING_SCHEDULER_H_
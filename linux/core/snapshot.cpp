@@ -0,0 +1,196 @@
+#include "snapshot.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+#include "collectors.h"
+#include "hardware_profile.h"
+#include "stats.h"
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+int64_t NowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+// Fills in the fields of |snapshot| that change between samples.
+void CollectVolatile(DeviceSnapshot* snapshot) {
+  snapshot->timestampMs = NowMs();
+  snapshot->memory = MemoryCollector().Collect();
+  snapshot->storage = StorageCollector().Collect();
+  snapshot->battery = BatteryCollector().Collect();
+  snapshot->network = NetworkCollector().Collect();
+}
+
+}  // namespace
+
+DeviceSnapshot CollectSnapshot() {
+  DeviceSnapshot snapshot;
+  snapshot.system = SystemCollector().Collect();
+  snapshot.processor = ProcessorCollector().Collect();
+  CollectVolatile(&snapshot);
+  return snapshot;
+}
+
+SnapshotSampler::SnapshotSampler(std::chrono::milliseconds interval)
+    : interval_(interval) {}
+
+SnapshotSampler::~SnapshotSampler() {
+  Stop();
+}
+
+void SnapshotSampler::Start() {
+  if (started_) {
+    return;
+  }
+  started_ = true;
+  if (!configured_) {
+    configured_ = true;
+    HardwareProfile profile = LoadOrCollectHardwareProfile();
+    current_.system = profile.system;
+    current_.processor = profile.processor;
+    AddTasks();
+    // Changes only drive the backoff; every wakeup is published.
+    scheduler_.SetTickCallback([this](bool) { Publish(); });
+  }
+  scheduler_.Start();
+}
+
+void SnapshotSampler::Stop() {
+  scheduler_.Stop();
+  started_ = false;
+}
+
+std::shared_ptr<const DeviceSnapshot> SnapshotSampler::Latest() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return latest_;
+}
+
+void SnapshotSampler::AddTasks() {
+  using std::chrono::milliseconds;
+  using std::chrono::seconds;
+  auto atLeast = [this](milliseconds floor) {
+    return std::max<milliseconds>(interval_, floor);
+  };
+
+  // Each task stores every reading in |current_| but compares it against the
+  // reading that last counted as a change, so slow drift still resets the
+  // backoff once it adds up.
+  scheduler_.Add("memory", {CollectorCost::kCheap, interval_, interval_ * 8},
+                 [this, baseline = MemoryInfo(), cpuPrimed = false]() mutable {
+                   MemoryInfo memory = MemoryCollector().Collect();
+                   // Changes under 1% of RAM are noise.
+                   bool changed =
+                       memory.totalPhysicalMemory !=
+                           baseline.totalPhysicalMemory ||
+                       std::llabs(memory.availablePhysicalMemory -
+                                  baseline.availablePhysicalMemory) >
+                           memory.totalPhysicalMemory / 100;
+                   if (changed) baseline = memory;
+                   current_.memory = memory;
+                   Record(HistoryMetric::kMemoryUsage,
+                          memory.UsagePercentage());
+                   Record(HistoryMetric::kAvailableMemory,
+                          static_cast<double>(memory.availablePhysicalMemory));
+                   // CPU usage is only kept for the history. It is averaged
+                   // since the previous run; the first reading averages
+                   // since boot and is skipped.
+                   if (history_ != nullptr) {
+                     CpuLoad load = cpuLoad_.Collect();
+                     if (load.available && cpuPrimed) {
+                       Record(HistoryMetric::kCpuUsage, load.usagePercentage);
+                     }
+                     cpuPrimed = true;
+                   }
+                   return changed;
+                 });
+
+  // The battery files stay open and are re-read as one batch. Without a
+  // battery the collector's own (failing) read is just as cheap.
+  int capacity = batteryFiles_.Add(BatteryCollector::CapacityPath(), 16);
+  int status = capacity >= 0
+                   ? batteryFiles_.Add(BatteryCollector::StatusPath(), 32)
+                   : -1;
+  scheduler_.Add("battery",
+                 {CollectorCost::kCheap, atLeast(seconds(5)),
+                  atLeast(seconds(60))},
+                 [this, capacity, status] {
+                   BatteryInfo battery;
+                   if (capacity >= 0) {
+                     ScopedCollectTimer timer(StatCollector::kBattery);
+                     batteryFiles_.ReadAll();
+                     battery = BatteryCollector::Parse(
+                         batteryFiles_.Data(capacity),
+                         batteryFiles_.Data(status));
+                   } else {
+                     battery = BatteryCollector().Collect();
+                   }
+                   const BatteryInfo& previous = current_.battery;
+                   bool changed =
+                       battery.present != previous.present ||
+                       battery.batteryLevel != previous.batteryLevel ||
+                       battery.chargingStatus != previous.chargingStatus;
+                   current_.battery = battery;
+                   if (battery.present) {
+                     Record(HistoryMetric::kBatteryLevel, battery.batteryLevel);
+                   }
+                   return changed;
+                 });
+
+  scheduler_.Add("storage",
+                 {CollectorCost::kExpensive, atLeast(seconds(30)),
+                  atLeast(seconds(300))},
+                 [this, baseline = StorageInfo()]() mutable {
+                   StorageInfo storage = StorageCollector().Collect();
+                   // Changes under 0.1% of the disk are noise.
+                   bool changed =
+                       storage.totalStorageSpace !=
+                           baseline.totalStorageSpace ||
+                       std::llabs(storage.availableStorageSpace -
+                                  baseline.availableStorageSpace) >
+                           storage.totalStorageSpace / 1000;
+                   if (changed) baseline = storage;
+                   current_.storage = storage;
+                   Record(HistoryMetric::kAvailableStorage,
+                          static_cast<double>(storage.availableStorageSpace));
+                   return changed;
+                 });
+
+  scheduler_.Add("network",
+                 {CollectorCost::kExpensive, atLeast(seconds(10)),
+                  atLeast(seconds(120))},
+                 [this] {
+                   NetworkInfo network = NetworkCollector().Collect();
+                   const NetworkInfo& previous = current_.network;
+                   bool changed = network.ipAddress != previous.ipAddress ||
+                                  network.macAddress != previous.macAddress;
+                   current_.network = network;
+                   return changed;
+                 });
+}
+
+void SnapshotSampler::Record(HistoryMetric metric, double value) {
+  if (history_ != nullptr) {
+    history_->Record(metric, NowMs(), value);
+  }
+}
+
+void SnapshotSampler::Publish() {
+  auto snapshot = std::make_shared<DeviceSnapshot>(current_);
+  snapshot->timestampMs = NowMs();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot->sequence = latest_ ? latest_->sequence + 1 : 1;
+    latest_ = snapshot;
+  }
+  if (listener_) {
+    listener_(*snapshot);
+  }
+}
+
+}  // namespace flutter_device_info_plus
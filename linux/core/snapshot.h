@@ -0,0 +1,113 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "batch_reader.h"
+#include "collectors.h"
+#include "device_info_types.h"
+#include "metric_history.h"
+#include "sampling_scheduler.h"
+
+namespace flutter_device_info_plus {
+
+// A consistent view of every collector at one point in time.
+struct DeviceSnapshot {
+  // Incremented for every sample taken by a SnapshotSampler.
+  uint64_t sequence = 0;
+  // Wall clock time of the sample in milliseconds since the epoch.
+  int64_t timestampMs = 0;
+
+  SystemInfo system;
+  ProcessorInfo processor;
+  MemoryInfo memory;
+  StorageInfo storage;
+  BatteryInfo battery;
+  NetworkInfo network;
+};
+
+// Collects a full snapshot synchronously on the calling thread.
+DeviceSnapshot CollectSnapshot();
+
+// Samples the collectors on a background thread and caches the most recent
+// snapshot, so readers never touch procfs themselves.
+//
+// Facts that can't change while the process runs (system and processor
+// information) are loaded once in Start(), from the on-disk hardware
+// profile when it is still valid. The other collectors are driven by a
+// SamplingScheduler: memory is sampled every |interval|, while battery,
+// storage and network have longer minimum intervals, and all of them back
+// off while their values are stable. Every wakeup publishes a snapshot with
+// the latest values, a fresh timestamp and the next sequence number, so
+// readers can tell a stable system from a stalled sampler.
+class SnapshotSampler {
+ public:
+  explicit SnapshotSampler(std::chrono::milliseconds interval);
+  ~SnapshotSampler();
+
+  // Disallow copy and assign.
+  SnapshotSampler(const SnapshotSampler&) = delete;
+  SnapshotSampler& operator=(const SnapshotSampler&) = delete;
+
+  // Called with every new snapshot on the thread that took it. Must be set
+  // before Start().
+  using Listener = std::function<void(const DeviceSnapshot&)>;
+  void SetListener(Listener listener) { listener_ = std::move(listener); }
+
+  // Also records every reading of CPU usage, memory, storage and battery
+  // level into |history|, which must outlive the sampler. Readings follow
+  // the tasks' intervals, so stable metrics fill fewer buckets. Must be set
+  // before the first Start().
+  void SetHistory(MetricHistory* history) { history_ = history; }
+
+  // Takes the first sample synchronously, then starts the sampling thread.
+  // Does nothing if already started.
+  void Start();
+
+  // Stops the sampling thread. The last snapshot stays available, and
+  // Start() resumes sampling (and sequence numbers) where it left off.
+  void Stop();
+
+  bool started() const { return started_; }
+  std::chrono::milliseconds interval() const { return interval_; }
+
+  // Suspends sampling, e.g. while nobody is looking at the values. Resume()
+  // refreshes every stale collector right away.
+  void Pause() { scheduler_.Pause(); }
+  void Resume() { scheduler_.Resume(); }
+
+  // Returns the most recent snapshot, or null before Start() was called.
+  // Cheap enough to be called for every request.
+  std::shared_ptr<const DeviceSnapshot> Latest() const;
+
+ private:
+  void AddTasks();
+  void Publish();
+  // Adds |value| to |history_|, if set, at the current time.
+  void Record(HistoryMetric metric, double value);
+
+  const std::chrono::milliseconds interval_;
+  SamplingScheduler scheduler_;
+  Listener listener_;
+  MetricHistory* history_ = nullptr;
+  bool started_ = false;
+  // Whether the tasks were added by a previous Start().
+  bool configured_ = false;
+
+  // Only touched by the scheduler's tasks, which never run concurrently.
+  DeviceSnapshot current_;
+  BatchReader batteryFiles_;
+  CpuLoadCollector cpuLoad_;
+
+  mutable std::mutex mutex_;
+  std::shared_ptr<const DeviceSnapshot> latest_;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_H_
@@ -0,0 +1,226 @@
+#include "snapshot_encoders.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+// Minimal streaming JSON writer; commas are inserted automatically.
+class JsonWriter {
+ public:
+  void BeginObject(const char* key = nullptr) {
+    Key(key);
+    out_ += '{';
+    first_.push_back(true);
+  }
+
+  void EndObject() {
+    out_ += '}';
+    first_.pop_back();
+  }
+
+  void String(const char* key, const std::string& value) {
+    Key(key);
+    Quote(value);
+  }
+
+  void Int(const char* key, int64_t value) {
+    Key(key);
+    out_ += std::to_string(value);
+  }
+
+  void Double(const char* key, double value) {
+    Key(key);
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.15g", value);
+    out_ += buffer;
+  }
+
+  void Bool(const char* key, bool value) {
+    Key(key);
+    out_ += value ? "true" : "false";
+  }
+
+  void Null(const char* key) {
+    Key(key);
+    out_ += "null";
+  }
+
+  void StringList(const char* key, const std::vector<std::string>& values) {
+    Key(key);
+    out_ += '[';
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (i > 0) out_ += ',';
+      Quote(values[i]);
+    }
+    out_ += ']';
+  }
+
+  std::string Take() { return std::move(out_); }
+
+ private:
+  void Key(const char* key) {
+    if (!first_.empty()) {
+      if (!first_.back()) out_ += ',';
+      first_.back() = false;
+    }
+    if (key != nullptr) {
+      Quote(key);
+      out_ += ':';
+    }
+  }
+
+  void Quote(const std::string& value) {
+    out_ += '"';
+    for (char c : value) {
+      switch (c) {
+        case '"': out_ += "\\\""; break;
+        case '\\': out_ += "\\\\"; break;
+        case '\n': out_ += "\\n"; break;
+        case '\r': out_ += "\\r"; break;
+        case '\t': out_ += "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out_ += escaped;
+          } else {
+            out_ += c;
+          }
+      }
+    }
+    out_ += '"';
+  }
+
+  std::string out_;
+  std::vector<bool> first_;
+};
+
+// Escapes a Prometheus label value.
+std::string EscapeLabel(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (char c : value) {
+    switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      default: escaped += c;
+    }
+  }
+  return escaped;
+}
+
+void AppendGauge(std::string* out, const char* name, const char* help,
+                 double value) {
+  char buffer[256];
+  snprintf(buffer, sizeof(buffer), "# HELP %s %s\n# TYPE %s gauge\n%s %.15g\n",
+           name, help, name, name, value);
+  *out += buffer;
+}
+
+}  // namespace
+
+std::string EncodeSnapshotJson(const DeviceSnapshot& snapshot) {
+  JsonWriter json;
+  json.BeginObject();
+  json.Int("sequence", static_cast<int64_t>(snapshot.sequence));
+  json.Int("timestamp", snapshot.timestampMs);
+
+  const SystemInfo& system = snapshot.system;
+  json.String("deviceId", system.deviceId);
+  json.String("deviceName", system.deviceName);
+  json.String("manufacturer", system.manufacturer);
+  json.String("model", system.model);
+  json.String("brand", system.brand);
+  json.String("operatingSystem", system.operatingSystem);
+  json.String("systemVersion", system.systemVersion);
+  json.String("buildNumber", system.buildNumber);
+  json.String("kernelVersion", system.kernelVersion);
+
+  const ProcessorInfo& processor = snapshot.processor;
+  json.BeginObject("processorInfo");
+  json.String("architecture", processor.architecture);
+  json.Int("coreCount", processor.coreCount);
+  json.Int("maxFrequency", processor.maxFrequency);
+  json.String("processorName", processor.processorName);
+  json.StringList("features", processor.features);
+  json.EndObject();
+
+  const MemoryInfo& memory = snapshot.memory;
+  const StorageInfo& storage = snapshot.storage;
+  json.BeginObject("memoryInfo");
+  json.Int("totalPhysicalMemory", memory.totalPhysicalMemory);
+  json.Int("availablePhysicalMemory", memory.availablePhysicalMemory);
+  json.Int("totalStorageSpace", storage.totalStorageSpace);
+  json.Int("availableStorageSpace", storage.availableStorageSpace);
+  json.Int("usedStorageSpace", storage.UsedStorageSpace());
+  json.Double("memoryUsagePercentage", memory.UsagePercentage());
+  json.EndObject();
+
+  const BatteryInfo& battery = snapshot.battery;
+  if (battery.present) {
+    json.BeginObject("batteryInfo");
+    json.Int("batteryLevel", battery.batteryLevel);
+    json.String("chargingStatus", battery.chargingStatus);
+    json.String("batteryHealth", battery.batteryHealth);
+    json.Int("batteryCapacity", battery.batteryCapacity);
+    json.Double("batteryVoltage", battery.batteryVoltage);
+    json.Double("batteryTemperature", battery.batteryTemperature);
+    json.EndObject();
+  } else {
+    json.Null("batteryInfo");
+  }
+
+  const NetworkInfo& network = snapshot.network;
+  json.BeginObject("networkInfo");
+  json.String("connectionType", network.connectionType);
+  json.String("networkSpeed", network.networkSpeed);
+  json.Bool("isConnected", network.IsConnected());
+  json.String("ipAddress", network.ipAddress);
+  json.String("macAddress", network.macAddress);
+  json.EndObject();
+
+  json.EndObject();
+  return json.Take();
+}
+
+std::string EncodeSnapshotPrometheus(const DeviceSnapshot& snapshot) {
+  std::string out;
+
+  out += "# HELP fdip_device_info Static device facts.\n";
+  out += "# TYPE fdip_device_info gauge\n";
+  out += "fdip_device_info{device_id=\"" + EscapeLabel(snapshot.system.deviceId) +
+         "\",device_name=\"" + EscapeLabel(snapshot.system.deviceName) +
+         "\",kernel=\"" + EscapeLabel(snapshot.system.kernelVersion) +
+         "\",architecture=\"" + EscapeLabel(snapshot.processor.architecture) +
+         "\",processor=\"" + EscapeLabel(snapshot.processor.processorName) +
+         "\"} 1\n";
+
+  AppendGauge(&out, "fdip_sample_timestamp_seconds",
+              "Time the sample was taken.", snapshot.timestampMs / 1000.0);
+  AppendGauge(&out, "fdip_cpu_cores", "Online processor cores.",
+              snapshot.processor.coreCount);
+  AppendGauge(&out, "fdip_cpu_frequency_mhz", "Processor frequency in MHz.",
+              snapshot.processor.maxFrequency);
+  AppendGauge(&out, "fdip_memory_total_bytes", "Total physical memory.",
+              static_cast<double>(snapshot.memory.totalPhysicalMemory));
+  AppendGauge(&out, "fdip_memory_available_bytes", "Available physical memory.",
+              static_cast<double>(snapshot.memory.availablePhysicalMemory));
+  AppendGauge(&out, "fdip_storage_total_bytes", "Total storage space.",
+              static_cast<double>(snapshot.storage.totalStorageSpace));
+  AppendGauge(&out, "fdip_storage_available_bytes", "Available storage space.",
+              static_cast<double>(snapshot.storage.availableStorageSpace));
+  if (snapshot.battery.present) {
+    AppendGauge(&out, "fdip_battery_level_percent", "Battery charge level.",
+                snapshot.battery.batteryLevel);
+  }
+  AppendGauge(&out, "fdip_network_connected",
+              "1 if a non-loopback IPv4 address is configured.",
+              snapshot.network.IsConnected() ? 1 : 0);
+  return out;
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,19 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_ENCODERS_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_ENCODERS_H_
+
+#include <string>
+
+#include "snapshot.h"
+
+namespace flutter_device_info_plus {
+
+// Encodes |snapshot| as a JSON object using the same key names as the
+// method channel maps.
+std::string EncodeSnapshotJson(const DeviceSnapshot& snapshot);
+
+// Encodes |snapshot| in the Prometheus text exposition format (version 0.0.4).
+std::string EncodeSnapshotPrometheus(const DeviceSnapshot& snapshot);
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_ENCODERS_H_
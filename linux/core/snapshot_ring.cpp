@@ -0,0 +1,259 @@
+#include "snapshot_ring.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+static_assert(sizeof(fdip_sample) % sizeof(uint64_t) == 0,
+              "fdip_sample is copied one 64-bit word at a time");
+static_assert(sizeof(fdip_ring_slot) == 128, "slot must span two cache lines");
+static_assert(offsetof(fdip_ring_header, slots) == 64,
+              "header must span one cache line");
+
+constexpr size_t kSampleWords = sizeof(fdip_sample) / sizeof(uint64_t);
+
+// The sample is copied with relaxed atomic word accesses so that a reader
+// racing with the writer is well defined; the slot's seq detects tearing.
+void LoadSample(const fdip_sample* from, fdip_sample* to) {
+  const uint64_t* src = reinterpret_cast<const uint64_t*>(from);
+  uint64_t* dst = reinterpret_cast<uint64_t*>(to);
+  for (size_t i = 0; i < kSampleWords; ++i) {
+    dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+  }
+}
+
+void StoreSample(const fdip_sample* from, fdip_sample* to) {
+  const uint64_t* src = reinterpret_cast<const uint64_t*>(from);
+  uint64_t* dst = reinterpret_cast<uint64_t*>(to);
+  for (size_t i = 0; i < kSampleWords; ++i) {
+    __atomic_store_n(&dst[i], src[i], __ATOMIC_RELAXED);
+  }
+}
+
+// Copies the sample in |slot|. Returns false if the writer was active.
+bool TryReadSlot(const fdip_ring_slot* slot, fdip_sample* out) {
+  uint64_t before = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+  if (before & 1) {
+    return false;
+  }
+  LoadSample(&slot->sample, out);
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  return __atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == before;
+}
+
+// Bounds the retries of a reader that keeps losing to the writer.
+constexpr int kMaxReadAttempts = 16;
+
+fdip_ring_header* MapRing(int fd, bool writable) {
+  void* address = mmap(nullptr, sizeof(fdip_ring_header),
+                       writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                       MAP_SHARED, fd, 0);
+  return address == MAP_FAILED ? nullptr
+                               : static_cast<fdip_ring_header*>(address);
+}
+
+// Prefix of the names of this user's rings, without the leading slash.
+std::string RingNamePrefix() {
+  return "flutter_device_info_plus." + std::to_string(getuid()) + ".";
+}
+
+bool IsProcessAlive(pid_t pid) {
+  return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+// Returns whether the ring called |name| belongs to a writer that still
+// runs. Regions that aren't rings, or can't be read, count as live so they
+// are never removed.
+bool HasLiveWriter(const std::string& name) {
+  int fd = shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+  if (fd < 0) {
+    return errno != ENOENT;
+  }
+  struct stat st;
+  fdip_ring_header* header = nullptr;
+  if (fstat(fd, &st) == 0 && st.st_uid == getuid() &&
+      st.st_size >= static_cast<off_t>(sizeof(fdip_ring_header))) {
+    header = MapRing(fd, false);
+  }
+  close(fd);
+  if (header == nullptr) {
+    return true;
+  }
+  bool live = __atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) !=
+                  FDIP_RING_MAGIC ||
+              IsProcessAlive(static_cast<pid_t>(header->writer_pid));
+  munmap(header, sizeof(fdip_ring_header));
+  return live;
+}
+
+}  // namespace
+
+std::string DefaultSnapshotRingName() {
+  return "/" + RingNamePrefix() + std::to_string(getpid());
+}
+
+void RemoveStaleSnapshotRings() {
+  DIR* dir = opendir("/dev/shm");
+  if (dir == nullptr) {
+    return;
+  }
+  std::string prefix = RingNamePrefix();
+  while (struct dirent* entry = readdir(dir)) {
+    if (strncmp(entry->d_name, prefix.c_str(), prefix.size()) != 0) continue;
+    std::string name = std::string("/") + entry->d_name;
+    if (!HasLiveWriter(name)) {
+      shm_unlink(name.c_str());
+    }
+  }
+  closedir(dir);
+}
+
+bool ReadLatestSample(const fdip_ring_header* header, fdip_sample* out) {
+  for (int attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+    uint64_t count = __atomic_load_n(&header->write_count, __ATOMIC_ACQUIRE);
+    if (count == 0) {
+      return false;
+    }
+    const fdip_ring_slot* slot =
+        &header->slots[(count - 1) % FDIP_RING_CAPACITY];
+    if (TryReadSlot(slot, out) && out->sequence == count) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ReadSample(const fdip_ring_header* header, uint64_t sequence,
+                fdip_sample* out) {
+  if (sequence == 0) {
+    return false;
+  }
+  const fdip_ring_slot* slot =
+      &header->slots[(sequence - 1) % FDIP_RING_CAPACITY];
+  for (int attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+    if (TryReadSlot(slot, out)) {
+      return out->sequence == sequence;
+    }
+  }
+  return false;
+}
+
+std::unique_ptr<SnapshotRing> SnapshotRing::Create(const std::string& name) {
+  std::string mappedName = name;
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+  if (fd < 0 && errno == EEXIST) {
+    // Readers attached by name must never be switched to another writer.
+    if (HasLiveWriter(name)) {
+      return nullptr;
+    }
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+  }
+  if (fd < 0) {
+    mappedName.clear();
+    fd = memfd_create("flutter_device_info_plus", MFD_CLOEXEC);
+    if (fd < 0) {
+      return nullptr;
+    }
+  }
+
+  fdip_ring_header* header = nullptr;
+  if (ftruncate(fd, sizeof(fdip_ring_header)) == 0) {
+    header = MapRing(fd, true);
+  }
+  close(fd);
+  if (header == nullptr) {
+    if (!mappedName.empty()) shm_unlink(mappedName.c_str());
+    return nullptr;
+  }
+
+  // ftruncate() zero-fills the region; only the identification is needed.
+  header->capacity = FDIP_RING_CAPACITY;
+  header->sample_size = sizeof(fdip_sample);
+  header->version = FDIP_RING_VERSION;
+  header->writer_pid = static_cast<uint32_t>(getpid());
+  __atomic_store_n(&header->magic, FDIP_RING_MAGIC, __ATOMIC_RELEASE);
+  return std::unique_ptr<SnapshotRing>(
+      new SnapshotRing(header, mappedName, true));
+}
+
+std::unique_ptr<SnapshotRing> SnapshotRing::Open(const std::string& name) {
+  int fd = shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st;
+  fdip_ring_header* header = nullptr;
+  if (fstat(fd, &st) == 0 &&
+      st.st_size >= static_cast<off_t>(sizeof(fdip_ring_header))) {
+    header = MapRing(fd, false);
+  }
+  close(fd);
+  if (header == nullptr) {
+    return nullptr;
+  }
+
+  if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != FDIP_RING_MAGIC ||
+      header->version != FDIP_RING_VERSION ||
+      header->capacity != FDIP_RING_CAPACITY ||
+      header->sample_size != sizeof(fdip_sample)) {
+    munmap(header, sizeof(fdip_ring_header));
+    return nullptr;
+  }
+  return std::unique_ptr<SnapshotRing>(new SnapshotRing(header, name, false));
+}
+
+SnapshotRing::SnapshotRing(fdip_ring_header* header, std::string name,
+                           bool owner)
+    : header_(header), name_(std::move(name)), owner_(owner) {}
+
+SnapshotRing::~SnapshotRing() {
+  munmap(header_, sizeof(fdip_ring_header));
+  Unlink();
+}
+
+void SnapshotRing::Unlink() {
+  if (owner_ && !name_.empty()) {
+    shm_unlink(name_.c_str());
+    name_.clear();
+  }
+}
+
+void SnapshotRing::Publish(const DeviceSnapshot& snapshot) {
+  uint64_t count = __atomic_load_n(&header_->write_count, __ATOMIC_RELAXED);
+  fdip_ring_slot* slot = &header_->slots[count % FDIP_RING_CAPACITY];
+
+  fdip_sample sample;
+  memset(&sample, 0, sizeof(sample));
+  sample.sequence = count + 1;
+  sample.timestamp_ms = snapshot.timestampMs;
+  sample.total_physical_memory = snapshot.memory.totalPhysicalMemory;
+  sample.available_physical_memory = snapshot.memory.availablePhysicalMemory;
+  sample.total_storage_space = snapshot.storage.totalStorageSpace;
+  sample.available_storage_space = snapshot.storage.availableStorageSpace;
+  sample.core_count = snapshot.processor.coreCount;
+  sample.max_frequency = snapshot.processor.maxFrequency;
+  sample.battery_level =
+      snapshot.battery.present ? snapshot.battery.batteryLevel : -1;
+  sample.is_connected = snapshot.network.IsConnected() ? 1 : 0;
+
+  uint64_t seq = __atomic_load_n(&slot->seq, __ATOMIC_RELAXED);
+  __atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  StoreSample(&sample, &slot->sample);
+  __atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+  __atomic_store_n(&header_->write_count, count + 1, __ATOMIC_RELEASE);
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,79 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_RING_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_RING_H_
+
+#include <memory>
+#include <string>
+
+#include "include/flutter_device_info_plus/fdip_snapshot_ring.h"
+#include "snapshot.h"
+
+namespace flutter_device_info_plus {
+
+// Returns the shm_open() name used for this process's ring. It includes the
+// uid and pid, so several instances of an app never share a ring.
+std::string DefaultSnapshotRingName();
+
+// Unlinks rings left in /dev/shm by processes of this user that exited
+// without removing them, e.g. because they crashed.
+void RemoveStaleSnapshotRings();
+
+// Reads the newest sample from a mapped ring without taking any lock.
+// Returns false if nothing has been published yet.
+bool ReadLatestSample(const fdip_ring_header* header, fdip_sample* out);
+
+// Reads the sample with the given sequence number. Returns false if it was
+// never published or has already been overwritten.
+bool ReadSample(const fdip_ring_header* header, uint64_t sequence,
+                fdip_sample* out);
+
+// A fdip_ring_header mapped into this process. See fdip_snapshot_ring.h for
+// the protocol.
+class SnapshotRing {
+ public:
+  // Creates the region named |name| and maps it for writing. A region left
+  // behind by a writer that no longer runs is replaced, but one whose writer
+  // is still alive is never taken over; Create() returns null then. Falls
+  // back to an anonymous memfd if POSIX shared memory is unavailable, in
+  // which case name() is empty and only this process can read the ring.
+  // Returns null on failure.
+  static std::unique_ptr<SnapshotRing> Create(const std::string& name);
+
+  // Maps an existing region read-only. Returns null if it doesn't exist or
+  // was written by an incompatible version.
+  static std::unique_ptr<SnapshotRing> Open(const std::string& name);
+
+  ~SnapshotRing();
+
+  // Disallow copy and assign.
+  SnapshotRing(const SnapshotRing&) = delete;
+  SnapshotRing& operator=(const SnapshotRing&) = delete;
+
+  // Removes the ring's name so no new reader can open it and nothing is
+  // left in /dev/shm. The mapping, and readers that already opened it, stay
+  // valid. Also done by the destructor of a ring returned by Create().
+  void Unlink();
+
+  // Publishes |snapshot| as the newest sample. Must only be called from one
+  // thread at a time, and only on rings returned by Create().
+  void Publish(const DeviceSnapshot& snapshot);
+
+  bool ReadLatest(fdip_sample* out) const {
+    return ReadLatestSample(header_, out);
+  }
+
+  const fdip_ring_header* header() const { return header_; }
+
+  // The shm_open() name, or empty for an anonymous or unlinked ring.
+  const std::string& name() const { return name_; }
+
+ private:
+  SnapshotRing(fdip_ring_header* header, std::string name, bool owner);
+
+  fdip_ring_header* header_;
+  std::string name_;
+  bool owner_;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_SNAPSHOT_RING_H_
@@ -0,0 +1,139 @@
+#include "stats.h"
+
+#include <time.h>
+#include <atomic>
+
+#if defined(FLUTTER_DEVICE_INFO_PLUS_ENABLE_USDT)
+#include <sys/sdt.h>
+#endif
+
+namespace flutter_device_info_plus {
+
+namespace {
+
+constexpr int kCollectorCount = static_cast<int>(StatCollector::kCount);
+constexpr int kCacheCount = static_cast<int>(StatCache::kCount);
+
+struct AtomicCollectorStats {
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> totalNs{0};
+  std::atomic<uint64_t> maxNs{0};
+};
+
+struct AtomicCacheStats {
+  std::atomic<uint64_t> hits{0};
+  std::atomic<uint64_t> misses{0};
+  std::atomic<uint64_t> joins{0};
+};
+
+// Zero-initialized statics, so recording works during static init too.
+AtomicCollectorStats gCollectors[kCollectorCount];
+AtomicCacheStats gCaches[kCacheCount];
+std::atomic<uint64_t> gFileReads{0};
+std::atomic<uint64_t> gBytesRead{0};
+
+uint64_t MonotonicNs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000000u +
+         static_cast<uint64_t>(now.tv_nsec);
+}
+
+}  // namespace
+
+const char* StatCollectorName(StatCollector collector) {
+  switch (collector) {
+    case StatCollector::kSystem: return "system";
+    case StatCollector::kProcessor: return "processor";
+    case StatCollector::kCpuTopology: return "cpuTopology";
+    case StatCollector::kCpuLoad: return "cpuLoad";
+    case StatCollector::kMemory: return "memory";
+    case StatCollector::kStorage: return "storage";
+    case StatCollector::kDisplay: return "display";
+    case StatCollector::kSecurity: return "security";
+    case StatCollector::kBattery: return "battery";
+    case StatCollector::kSensor: return "sensor";
+    case StatCollector::kNetwork: return "network";
+    case StatCollector::kResourceLimits: return "resourceLimits";
+    case StatCollector::kGpus: return "gpus";
+    case StatCollector::kCount: break;
+  }
+  return "unknown";
+}
+
+const char* StatCacheName(StatCache cache) {
+  switch (cache) {
+    case StatCache::kQueryResult: return "queryResult";
+    case StatCache::kResourceLimits: return "resourceLimits";
+    case StatCache::kHardwareProfile: return "hardwareProfile";
+    case StatCache::kGpus: return "gpus";
+    case StatCache::kCount: break;
+  }
+  return "unknown";
+}
+
+void RecordCollect(StatCollector collector, uint64_t elapsedNs) {
+  AtomicCollectorStats& stats = gCollectors[static_cast<int>(collector)];
+  stats.calls.fetch_add(1, std::memory_order_relaxed);
+  stats.totalNs.fetch_add(elapsedNs, std::memory_order_relaxed);
+  uint64_t max = stats.maxNs.load(std::memory_order_relaxed);
+  while (elapsedNs > max &&
+         !stats.maxNs.compare_exchange_weak(max, elapsedNs,
+                                            std::memory_order_relaxed)) {
+  }
+#if defined(FLUTTER_DEVICE_INFO_PLUS_ENABLE_USDT)
+  DTRACE_PROBE2(flutter_device_info_plus, collect,
+                StatCollectorName(collector), elapsedNs);
+#endif
+}
+
+void RecordCacheLookup(StatCache cache, bool hit) {
+  AtomicCacheStats& stats = gCaches[static_cast<int>(cache)];
+  (hit ? stats.hits : stats.misses).fetch_add(1, std::memory_order_relaxed);
+#if defined(FLUTTER_DEVICE_INFO_PLUS_ENABLE_USDT)
+  DTRACE_PROBE2(flutter_device_info_plus, cache, StatCacheName(cache),
+                hit ? 1 : 0);
+#endif
+}
+
+void RecordCacheJoin(StatCache cache) {
+  gCaches[static_cast<int>(cache)].joins.fetch_add(1,
+                                                   std::memory_order_relaxed);
+#if defined(FLUTTER_DEVICE_INFO_PLUS_ENABLE_USDT)
+  DTRACE_PROBE2(flutter_device_info_plus, cache, StatCacheName(cache), 2);
+#endif
+}
+
+void RecordFileRead(size_t bytes) {
+  gFileReads.fetch_add(1, std::memory_order_relaxed);
+  gBytesRead.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+PluginStats ReadPluginStats() {
+  PluginStats stats;
+  for (int i = 0; i < kCollectorCount; ++i) {
+    stats.collectors[i].calls =
+        gCollectors[i].calls.load(std::memory_order_relaxed);
+    stats.collectors[i].totalNs =
+        gCollectors[i].totalNs.load(std::memory_order_relaxed);
+    stats.collectors[i].maxNs =
+        gCollectors[i].maxNs.load(std::memory_order_relaxed);
+  }
+  for (int i = 0; i < kCacheCount; ++i) {
+    stats.caches[i].hits = gCaches[i].hits.load(std::memory_order_relaxed);
+    stats.caches[i].misses = gCaches[i].misses.load(std::memory_order_relaxed);
+    stats.caches[i].joins = gCaches[i].joins.load(std::memory_order_relaxed);
+  }
+  stats.fileReads = gFileReads.load(std::memory_order_relaxed);
+  stats.bytesRead = gBytesRead.load(std::memory_order_relaxed);
+  return stats;
+}
+
+ScopedCollectTimer::ScopedCollectTimer(StatCollector collector)
+    : collector_(collector), startNs_(MonotonicNs()) {}
+
+ScopedCollectTimer::~ScopedCollectTimer() {
+  RecordCollect(collector_, MonotonicNs() - startNs_);
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,93 @@
+#ifndef FLUTTER_DEVICE_INFO_PLUS_CORE_STATS_H_
+#define FLUTTER_DEVICE_INFO_PLUS_CORE_STATS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flutter_device_info_plus {
+
+// Always-on counters describing where the plugin spends its time. Updates
+// are relaxed atomic increments, so recording is lock-free and safe from
+// any thread; a snapshot is therefore only approximately consistent.
+//
+// Building with FLUTTER_DEVICE_INFO_PLUS_ENABLE_USDT also fires the USDT
+// probes flutter_device_info_plus:collect(name, ns) and
+// flutter_device_info_plus:cache(name, hit) for perf and bpftrace, where hit
+// is 1 for a hit, 0 for a miss and 2 for a join.
+
+enum class StatCollector {
+  kSystem,
+  kProcessor,
+  kCpuTopology,
+  kCpuLoad,
+  kMemory,
+  kStorage,
+  kDisplay,
+  kSecurity,
+  kBattery,
+  kSensor,
+  kNetwork,
+  kResourceLimits,
+  kGpus,
+  kCount,
+};
+
+enum class StatCache {
+  // Coalesced method channel query results.
+  kQueryResult,
+  kResourceLimits,
+  // The on-disk hardware profile.
+  kHardwareProfile,
+  kGpus,
+  kCount,
+};
+
+struct CollectorStats {
+  uint64_t calls = 0;
+  uint64_t totalNs = 0;
+  uint64_t maxNs = 0;
+};
+
+struct CacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  // Lookups that waited for a collection already in flight.
+  uint64_t joins = 0;
+};
+
+struct PluginStats {
+  CollectorStats collectors[static_cast<int>(StatCollector::kCount)];
+  CacheStats caches[static_cast<int>(StatCache::kCount)];
+  // Files read from procfs and sysfs, and their total size.
+  uint64_t fileReads = 0;
+  uint64_t bytesRead = 0;
+};
+
+const char* StatCollectorName(StatCollector collector);
+const char* StatCacheName(StatCache cache);
+
+void RecordCollect(StatCollector collector, uint64_t elapsedNs);
+void RecordCacheLookup(StatCache cache, bool hit);
+void RecordCacheJoin(StatCache cache);
+void RecordFileRead(size_t bytes);
+
+PluginStats ReadPluginStats();
+
+// Times its scope with CLOCK_MONOTONIC and records it for |collector|.
+class ScopedCollectTimer {
+ public:
+  explicit ScopedCollectTimer(StatCollector collector);
+  ~ScopedCollectTimer();
+
+  // Disallow copy and assign.
+  ScopedCollectTimer(const ScopedCollectTimer&) = delete;
+  ScopedCollectTimer& operator=(const ScopedCollectTimer&) = delete;
+
+ private:
+  StatCollector collector_;
+  uint64_t startNs_;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_DEVICE_INFO_PLUS_CORE_STATS_H_
@@ -0,0 +1,123 @@
+#include "display_watcher.h"
+
+#include <utility>
+
+#include "core/collectors.h"
+
+namespace flutter_device_info_plus {
+
+DisplayWatcher::DisplayWatcher(GdkDisplay* display,
+                               std::function<void()> changed)
+    : display_(GDK_DISPLAY(g_object_ref(display))),
+      changed_(std::move(changed)) {
+  g_signal_connect(display_, "monitor-added", G_CALLBACK(OnMonitorAdded), this);
+  g_signal_connect(display_, "monitor-removed", G_CALLBACK(OnMonitorRemoved),
+                   this);
+}
+
+DisplayWatcher::~DisplayWatcher() {
+  if (idleSource_ != 0) {
+    g_source_remove(idleSource_);
+  }
+  UnwatchMonitors();
+  g_signal_handlers_disconnect_by_data(display_, this);
+  g_object_unref(display_);
+}
+
+const std::vector<MonitorInfo>& DisplayWatcher::Monitors() {
+  if (dirty_) {
+    Refresh();
+  }
+  return monitors_;
+}
+
+const MonitorInfo* DisplayWatcher::Primary() {
+  const std::vector<MonitorInfo>& monitors = Monitors();
+  for (const auto& monitor : monitors) {
+    if (monitor.isPrimary) {
+      return &monitor;
+    }
+  }
+  return monitors.empty() ? nullptr : &monitors.front();
+}
+
+void DisplayWatcher::OnMonitorAdded(GdkDisplay* display, GdkMonitor* monitor,
+                                    gpointer user_data) {
+  static_cast<DisplayWatcher*>(user_data)->Invalidate();
+}
+
+void DisplayWatcher::OnMonitorRemoved(GdkDisplay* display, GdkMonitor* monitor,
+                                      gpointer user_data) {
+  static_cast<DisplayWatcher*>(user_data)->Invalidate();
+}
+
+void DisplayWatcher::OnMonitorNotify(GObject* object, GParamSpec* pspec,
+                                     gpointer user_data) {
+  static_cast<DisplayWatcher*>(user_data)->Invalidate();
+}
+
+gboolean DisplayWatcher::OnIdle(gpointer user_data) {
+  DisplayWatcher* self = static_cast<DisplayWatcher*>(user_data);
+  self->idleSource_ = 0;
+  if (self->changed_) {
+    self->changed_();
+  }
+  return G_SOURCE_REMOVE;
+}
+
+void DisplayWatcher::Invalidate() {
+  dirty_ = true;
+  // Hotplug emits a burst of signals; report them as one change.
+  if (idleSource_ == 0) {
+    idleSource_ = g_idle_add(OnIdle, this);
+  }
+}
+
+void DisplayWatcher::Refresh() {
+  UnwatchMonitors();
+  monitors_.clear();
+
+  std::vector<DrmConnectorInfo> connectors =
+      DisplayCollector().CollectConnectors();
+  GdkMonitor* primary = gdk_display_get_primary_monitor(display_);
+  int count = gdk_display_get_n_monitors(display_);
+  for (int i = 0; i < count; ++i) {
+    GdkMonitor* monitor = gdk_display_get_monitor(display_, i);
+    if (monitor == nullptr) continue;
+
+    MonitorInfo info;
+    const char* model = gdk_monitor_get_model(monitor);
+    const char* manufacturer = gdk_monitor_get_manufacturer(monitor);
+    info.model = model != nullptr ? model : "";
+    info.manufacturer = manufacturer != nullptr ? manufacturer : "";
+    info.name = info.model;
+    GdkRectangle geometry;
+    gdk_monitor_get_geometry(monitor, &geometry);
+    info.x = geometry.x;
+    info.y = geometry.y;
+    info.width = geometry.width;
+    info.height = geometry.height;
+    info.scaleFactor = gdk_monitor_get_scale_factor(monitor);
+    // GDK reports millihertz.
+    info.refreshRate = gdk_monitor_get_refresh_rate(monitor) / 1000.0;
+    info.widthMm = gdk_monitor_get_width_mm(monitor);
+    info.heightMm = gdk_monitor_get_height_mm(monitor);
+    info.isPrimary = monitor == primary;
+    DisplayCollector::ApplyEdid(connectors, count, &info);
+    monitors_.push_back(std::move(info));
+
+    g_signal_connect(monitor, "notify", G_CALLBACK(OnMonitorNotify), this);
+    watched_.push_back(GDK_MONITOR(g_object_ref(monitor)));
+  }
+  dirty_ = false;
+}
+
+void DisplayWatcher::UnwatchMonitors() {
+  for (GdkMonitor* monitor : watched_) {
+    g_signal_handlers_disconnect_by_data(monitor, this);
+    g_object_unref(monitor);
+  }
+  watched_.clear();
+}
+
+}  // namespace flutter_device_info_plus
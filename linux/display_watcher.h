@@ -0,0 +1,57 @@
+#ifndef FLUTTER_PLUGIN_DISPLAY_WATCHER_H_
+#define FLUTTER_PLUGIN_DISPLAY_WATCHER_H_
+
+#include <gtk/gtk.h>
+
+#include <functional>
+#include <vector>
+
+#include "core/device_info_types.h"
+
+namespace flutter_device_info_plus {
+
+// Keeps a cached list of the monitors of a GdkDisplay, enriched with EDID
+// data from sysfs, and reports when it changes. Monitors are only
+// re-enumerated after GDK signals a change, so repeated queries are free.
+// Must be used on the GTK main thread.
+class DisplayWatcher {
+ public:
+  // |changed| is called from an idle callback after one or more monitors
+  // were added, removed or reconfigured.
+  DisplayWatcher(GdkDisplay* display, std::function<void()> changed);
+  ~DisplayWatcher();
+
+  // Disallow copy and assign.
+  DisplayWatcher(const DisplayWatcher&) = delete;
+  DisplayWatcher& operator=(const DisplayWatcher&) = delete;
+
+  const std::vector<MonitorInfo>& Monitors();
+
+  // The primary monitor, or the first one if none is marked primary.
+  // Returns null if there are no monitors.
+  const MonitorInfo* Primary();
+
+ private:
+  static void OnMonitorAdded(GdkDisplay* display, GdkMonitor* monitor,
+                             gpointer user_data);
+  static void OnMonitorRemoved(GdkDisplay* display, GdkMonitor* monitor,
+                               gpointer user_data);
+  static void OnMonitorNotify(GObject* object, GParamSpec* pspec,
+                              gpointer user_data);
+  static gboolean OnIdle(gpointer user_data);
+
+  void Invalidate();
+  void Refresh();
+  void UnwatchMonitors();
+
+  GdkDisplay* display_;
+  std::function<void()> changed_;
+  bool dirty_ = true;
+  guint idleSource_ = 0;
+  std::vector<GdkMonitor*> watched_;
+  std::vector<MonitorInfo> monitors_;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_PLUGIN_DISPLAY_WATCHER_H_
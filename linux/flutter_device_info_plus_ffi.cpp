@@ -0,0 +1,36 @@
+#include "include/flutter_device_info_plus/flutter_device_info_plus_ffi.h"
+
+#include <unistd.h>
+
+#include "core/collectors.h"
+#include "shared_sampling.h"
+
+using namespace flutter_device_info_plus;
+
+int32_t fdip_get_core_count(void) {
+  return static_cast<int32_t>(sysconf(_SC_NPROCESSORS_ONLN));
+}
+
+int32_t fdip_get_memory(fdip_memory* out) {
+  MemoryInfo memory = MemoryCollector().Collect();
+  out->total_physical_memory = memory.totalPhysicalMemory;
+  out->available_physical_memory = memory.availablePhysicalMemory;
+  return memory.totalPhysicalMemory > 0 ? 1 : 0;
+}
+
+int32_t fdip_get_cpu_load(fdip_cpu_load* out) {
+  static CpuLoadCollector* collector = new CpuLoadCollector();
+  CpuLoad load = collector->Collect();
+  out->usage_percentage = load.usagePercentage;
+  out->core_count = load.coreCount;
+  out->reserved = 0;
+  return load.available ? 1 : 0;
+}
+
+int32_t fdip_ring_read_latest(fdip_sample* out) {
+  return SharedSampling::Instance().ReadLatest(out) ? 1 : 0;
+}
+
+int32_t fdip_ring_read(uint64_t sequence, fdip_sample* out) {
+  return SharedSampling::Instance().Read(sequence, out) ? 1 : 0;
+}
@@ -2,45 +2,71 @@
 
 #include <flutter_linux/flutter_linux.h>
 #include <gtk/gtk.h>
-#include <sys/utsname.h>
-#include <sys/sysinfo.h>
-#include <sys/statvfs.h>
-#include <sys/socket.h>
-#include <netinet/in.h>
-#include <netdb.h>
-#include <fstream>
-#include <sstream>
-#include <memory>
-#include <vector>
-#include <map>
 #include <unistd.h>
-#include <ifaddrs.h>
-#include <net/if.h>
-#include <linux/if_packet.h>
-#include <linux/if_link.h>
+#include <chrono>
 #include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "core/cgroup.h"
+#include "core/collectors.h"
+#include "core/hardware_profile.h"
+#include "core/stats.h"
+#include "display_watcher.h"
+#include "request_coalescer.h"
+#include "shared_sampling.h"
+
+using namespace flutter_device_info_plus;
 
 #define FLUTTER_DEVICE_INFO_PLUS_PLUGIN(obj) \
   (G_TYPE_CHECK_INSTANCE_CAST((obj), flutter_device_info_plus_plugin_get_type(), \
                               FlutterDeviceInfoPlusPlugin))
 
+struct SamplingRequest;
+
 struct _FlutterDeviceInfoPlusPlugin {
   GObject parent_instance;
+
+  // Null when there is no GDK display (headless engine).
+  DisplayWatcher* displayWatcher;
+
+  FlEventChannel* monitorChannel;
+  gboolean monitorsListening;
+
+  // Shares one collection between concurrent identical queries.
+  RequestCoalescer* coalescer;
+
+  // startSharedSampling and stopSharedSampling calls waiting for the one
+  // running on a worker thread, in arrival order.
+  std::deque<SamplingRequest*>* samplingRequests;
+  gboolean samplingRequestRunning;
+
+  // getDeviceInfo fields that don't change while the app runs, encoded
+  // once and shared by reference between responses. The processorInfo
+  // template lacks coreCount, which follows CPU hotplug.
+  FlValue* deviceInfoTemplate;
+  FlValue* processorInfoTemplate;
+  // Encoded processorInfo for |coreCount| online CPUs; re-encoded only on
+  // CPU hotplug.
+  FlValue* processorInfo;
+  int coreCount;
+  // Encoded securityInfo and the reading it was encoded from; re-encoded
+  // only when the reading changes.
+  FlValue* securityInfo;
+  SecurityInfo* security;
+  // Encoded displayInfo, dropped whenever the monitors change.
+  FlValue* displayInfo;
+  // Encoded host name; re-encoded only if the host is renamed.
+  FlValue* deviceName;
+  char hostname[256];
 };
 
 G_DEFINE_TYPE(FlutterDeviceInfoPlusPlugin, flutter_device_info_plus_plugin, g_object_get_type())
 
-// Helper function to read file content
-static std::string ReadFile(const std::string& path) {
-  std::ifstream file(path);
-  if (file.is_open()) {
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
-  }
-  return "";
-}
-
 // Helper function to create FlValue from string
 static FlValue* CreateStringValue(const std::string& str) {
   return fl_value_new_string(str.c_str());
@@ -66,346 +92,581 @@ static FlValue* CreateMapValue() {
   return fl_value_new_map();
 }
 
+// Returns a process-lifetime FlValue for |key|, so each key is encoded
+// once instead of allocating a new string for every response. Keys are
+// looked up by contents through a view of the interned string itself, so
+// lookups don't allocate. Only used on the platform thread.
+static FlValue* InternKey(const char* key) {
+  static auto* keys = new std::unordered_map<std::string_view, FlValue*>();
+  auto it = keys->find(key);
+  if (it != keys->end()) {
+    return it->second;
+  }
+  FlValue* value = fl_value_new_string(key);
+  keys->emplace(fl_value_get_string(value), value);
+  return value;
+}
+
 // Helper function to set map value
 static void SetMapValue(FlValue* map, const char* key, FlValue* value) {
-  fl_value_set_take(map, CreateStringValue(key), value);
-}
-
-// Get processor architecture
-static std::string GetProcessorArchitecture() {
-  struct utsname unameInfo;
-  uname(&unameInfo);
-  std::string machine = unameInfo.machine;
-  
-  if (machine.find("x86_64") != std::string::npos || 
-      machine.find("amd64") != std::string::npos) {
-    return "x86_64";
-  } else if (machine.find("arm64") != std::string::npos || 
-             machine.find("aarch64") != std::string::npos) {
-    return "arm64";
-  } else if (machine.find("arm") != std::string::npos) {
-    return "arm";
-  } else if (machine.find("i386") != std::string::npos || 
-             machine.find("i686") != std::string::npos) {
-    return "x86";
-  }
-  return machine;
-}
-
-// Get processor core count
-static int GetProcessorCoreCount() {
-  return sysconf(_SC_NPROCESSORS_ONLN);
-}
-
-// Get processor max frequency
-static int GetProcessorMaxFrequency() {
-  std::string cpuinfo = ReadFile("/proc/cpuinfo");
-  if (!cpuinfo.empty()) {
-    size_t pos = cpuinfo.find("cpu MHz");
-    if (pos != std::string::npos) {
-      size_t start = cpuinfo.find(":", pos) + 1;
-      size_t end = cpuinfo.find("\n", start);
-      if (end != std::string::npos) {
-        std::string freq = cpuinfo.substr(start, end - start);
-        freq.erase(0, freq.find_first_not_of(" \t"));
-        freq.erase(freq.find_last_not_of(" \t") + 1);
-        return static_cast<int>(std::stod(freq));
-      }
-    }
+  fl_value_set_take(map, fl_value_ref(InternKey(key)), value);
+}
+
+// Helper function to create FlValue list from strings
+static FlValue* CreateStringListValue(const std::vector<std::string>& values) {
+  FlValue* list = fl_value_new_list();
+  for (const auto& value : values) {
+    fl_value_append_take(list, CreateStringValue(value));
   }
-  return 0;
-}
-
-// Get processor name
-static std::string GetProcessorName() {
-  std::string cpuinfo = ReadFile("/proc/cpuinfo");
-  if (!cpuinfo.empty()) {
-    size_t pos = cpuinfo.find("model name");
-    if (pos != std::string::npos) {
-      size_t start = cpuinfo.find(":", pos) + 1;
-      size_t end = cpuinfo.find("\n", start);
-      if (end != std::string::npos) {
-        std::string name = cpuinfo.substr(start, end - start);
-        name.erase(0, name.find_first_not_of(" \t"));
-        name.erase(name.find_last_not_of(" \t") + 1);
-        return name;
-      }
+  return list;
+}
+
+// The Encode* functions below translate the platform-neutral collector
+// results into the maps expected by the Dart side.
+
+// Encodes the static processor fields; coreCount is added per response.
+static FlValue* EncodeProcessorInfoTemplate(const ProcessorInfo& info) {
+  FlValue* processorInfo = CreateMapValue();
+  SetMapValue(processorInfo, "architecture", CreateStringValue(info.architecture));
+  SetMapValue(processorInfo, "maxFrequency", CreateIntValue(info.maxFrequency));
+  SetMapValue(processorInfo, "processorName", CreateStringValue(info.processorName));
+  SetMapValue(processorInfo, "features", CreateStringListValue(info.features));
+  return processorInfo;
+}
+
+static FlValue* EncodeMemoryInfo(const MemoryInfo& memory,
+                                 const StorageInfo& storage) {
+  FlValue* memoryInfo = CreateMapValue();
+  SetMapValue(memoryInfo, "totalPhysicalMemory", CreateIntValue(memory.totalPhysicalMemory));
+  SetMapValue(memoryInfo, "availablePhysicalMemory", CreateIntValue(memory.availablePhysicalMemory));
+  SetMapValue(memoryInfo, "totalStorageSpace", CreateIntValue(storage.totalStorageSpace));
+  SetMapValue(memoryInfo, "availableStorageSpace", CreateIntValue(storage.availableStorageSpace));
+  SetMapValue(memoryInfo, "usedStorageSpace", CreateIntValue(storage.UsedStorageSpace()));
+  SetMapValue(memoryInfo, "memoryUsagePercentage", CreateDoubleValue(memory.UsagePercentage()));
+  return memoryInfo;
+}
+
+static FlValue* EncodeDisplayInfo(const DisplayInfo& info) {
+  FlValue* displayInfo = CreateMapValue();
+  SetMapValue(displayInfo, "screenWidth", CreateIntValue(info.screenWidth));
+  SetMapValue(displayInfo, "screenHeight", CreateIntValue(info.screenHeight));
+  SetMapValue(displayInfo, "pixelDensity", CreateDoubleValue(info.pixelDensity));
+  SetMapValue(displayInfo, "refreshRate", CreateDoubleValue(info.refreshRate));
+  SetMapValue(displayInfo, "screenSizeInches", CreateDoubleValue(info.screenSizeInches));
+  SetMapValue(displayInfo, "orientation", CreateStringValue(info.orientation));
+  SetMapValue(displayInfo, "isHdr", CreateBoolValue(info.isHdr));
+  return displayInfo;
+}
+
+static FlValue* EncodeMonitorInfo(const MonitorInfo& info) {
+  FlValue* monitorInfo = CreateMapValue();
+  SetMapValue(monitorInfo, "name", CreateStringValue(info.name));
+  SetMapValue(monitorInfo, "manufacturer", CreateStringValue(info.manufacturer));
+  SetMapValue(monitorInfo, "model", CreateStringValue(info.model));
+  SetMapValue(monitorInfo, "x", CreateIntValue(info.x));
+  SetMapValue(monitorInfo, "y", CreateIntValue(info.y));
+  SetMapValue(monitorInfo, "width", CreateIntValue(info.width));
+  SetMapValue(monitorInfo, "height", CreateIntValue(info.height));
+  SetMapValue(monitorInfo, "scaleFactor", CreateIntValue(info.scaleFactor));
+  SetMapValue(monitorInfo, "refreshRate", CreateDoubleValue(info.refreshRate));
+  SetMapValue(monitorInfo, "widthMm", CreateIntValue(info.widthMm));
+  SetMapValue(monitorInfo, "heightMm", CreateIntValue(info.heightMm));
+  SetMapValue(monitorInfo, "isPrimary", CreateBoolValue(info.isPrimary));
+  SetMapValue(monitorInfo, "isHdr", CreateBoolValue(info.isHdr));
+  SetMapValue(monitorInfo, "maxLuminance", CreateDoubleValue(info.maxLuminance));
+  SetMapValue(monitorInfo, "bitDepth", CreateIntValue(info.bitDepth));
+  return monitorInfo;
+}
+
+static FlValue* EncodeSecurityInfo(const SecurityInfo& info) {
+  FlValue* securityInfo = CreateMapValue();
+  SetMapValue(securityInfo, "isDeviceSecure", CreateBoolValue(info.isDeviceSecure));
+  SetMapValue(securityInfo, "hasFingerprint", CreateBoolValue(info.hasFingerprint));
+  SetMapValue(securityInfo, "hasFaceUnlock", CreateBoolValue(info.hasFaceUnlock));
+  SetMapValue(securityInfo, "screenLockEnabled", CreateBoolValue(info.screenLockEnabled));
+  SetMapValue(securityInfo, "encryptionStatus", CreateStringValue(info.encryptionStatus));
+  return securityInfo;
+}
+
+// Get monitors
+static FlValue* GetMonitors(FlutterDeviceInfoPlusPlugin* self) {
+  FlValue* monitors = fl_value_new_list();
+  if (self->displayWatcher != nullptr) {
+    for (const auto& monitor : self->displayWatcher->Monitors()) {
+      fl_value_append_take(monitors, EncodeMonitorInfo(monitor));
     }
   }
-  return "Unknown Processor";
+  return monitors;
+}
+
+// The getDeviceInfo fields that can change at any time, read on a worker
+// thread for every call.
+struct LiveDeviceInfo {
+  MemoryInfo memory;
+  StorageInfo storage;
+  // Online CPUs; changes with CPU hotplug.
+  int coreCount = 0;
+  SecurityInfo security;
+  // Only loaded for the first call, to build the templates.
+  std::shared_ptr<const HardwareProfile> profile;
+};
+
+static LiveDeviceInfo CollectLiveDeviceInfo(bool needsProfile) {
+  LiveDeviceInfo info;
+  if (needsProfile) {
+    info.profile =
+        std::make_shared<HardwareProfile>(LoadOrCollectHardwareProfile());
+  }
+  info.memory = MemoryCollector().Collect();
+  info.storage = StorageCollector().Collect();
+  info.coreCount = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+  info.security = SecurityCollector().Collect();
+  return info;
 }
 
-// Get processor features
-static FlValue* GetProcessorFeatures() {
-  FlValue* features = fl_value_new_list();
-  std::string cpuinfo = ReadFile("/proc/cpuinfo");
-  
-  if (cpuinfo.find("neon") != std::string::npos) {
-    fl_value_append_take(features, CreateStringValue("NEON"));
+// Returns a new map holding the entries of |map| by reference.
+static FlValue* ShallowCopyMap(FlValue* map) {
+  FlValue* copy = CreateMapValue();
+  for (size_t i = 0; i < fl_value_get_length(map); ++i) {
+    fl_value_set(copy, fl_value_get_map_key(map, i),
+                 fl_value_get_map_value(map, i));
   }
-  if (cpuinfo.find("vfp") != std::string::npos) {
-    fl_value_append_take(features, CreateStringValue("VFP"));
+  return copy;
+}
+
+// Encodes the parts of getDeviceInfo that are fixed for the lifetime of
+// the process into |self|'s templates. |profile| was loaded on a worker
+// thread, from the on-disk hardware profile when it is still valid, so
+// neither step parses procfs on the main thread.
+static void EncodeDeviceInfoTemplate(FlutterDeviceInfoPlusPlugin* self,
+                                     const HardwareProfile& profile) {
+  FlValue* deviceInfo = CreateMapValue();
+
+  const SystemInfo& system = profile.system;
+  SetMapValue(deviceInfo, "deviceId", CreateStringValue(system.deviceId));
+  SetMapValue(deviceInfo, "manufacturer", CreateStringValue(system.manufacturer));
+  SetMapValue(deviceInfo, "model", CreateStringValue(system.model));
+  SetMapValue(deviceInfo, "brand", CreateStringValue(system.brand));
+  SetMapValue(deviceInfo, "operatingSystem", CreateStringValue(system.operatingSystem));
+  SetMapValue(deviceInfo, "systemVersion", CreateStringValue(system.systemVersion));
+  SetMapValue(deviceInfo, "buildNumber", CreateStringValue(system.buildNumber));
+  SetMapValue(deviceInfo, "kernelVersion", CreateStringValue(system.kernelVersion));
+
+  self->deviceInfoTemplate = deviceInfo;
+  self->processorInfoTemplate = EncodeProcessorInfoTemplate(profile.processor);
+}
+
+static bool SameSecurityInfo(const SecurityInfo& a, const SecurityInfo& b) {
+  return a.isDeviceSecure == b.isDeviceSecure &&
+         a.hasFingerprint == b.hasFingerprint &&
+         a.hasFaceUnlock == b.hasFaceUnlock &&
+         a.screenLockEnabled == b.screenLockEnabled &&
+         a.encryptionStatus == b.encryptionStatus;
+}
+
+// Get device info from |live|, collected off the main thread
+//
+// Only memoryInfo is re-encoded on every call. The static fields are
+// shallow-copied from the template, so their strings and lists are shared
+// by reference rather than rebuilt, and the other nested maps are reused
+// until their values change.
+static FlValue* GetDeviceInfo(FlutterDeviceInfoPlusPlugin* self,
+                              const LiveDeviceInfo& live) {
+  if (self->deviceInfoTemplate == nullptr) {
+    // Collections started before the templates existed carry the profile.
+    EncodeDeviceInfoTemplate(self, *live.profile);
   }
-  if (cpuinfo.find("avx") != std::string::npos) {
-    fl_value_append_take(features, CreateStringValue("AVX"));
+  FlValue* deviceInfo = ShallowCopyMap(self->deviceInfoTemplate);
+
+  if (self->processorInfo == nullptr || live.coreCount != self->coreCount) {
+    g_clear_pointer(&self->processorInfo, fl_value_unref);
+    self->processorInfo = ShallowCopyMap(self->processorInfoTemplate);
+    SetMapValue(self->processorInfo, "coreCount",
+                CreateIntValue(live.coreCount));
+    self->coreCount = live.coreCount;
   }
-  if (cpuinfo.find("avx2") != std::string::npos) {
-    fl_value_append_take(features, CreateStringValue("AVX2"));
+  fl_value_set(deviceInfo, InternKey("processorInfo"), self->processorInfo);
+
+  if (self->securityInfo == nullptr || !SameSecurityInfo(*self->security,
+                                                         live.security)) {
+    g_clear_pointer(&self->securityInfo, fl_value_unref);
+    self->securityInfo = EncodeSecurityInfo(live.security);
+    *self->security = live.security;
   }
-  if (cpuinfo.find("sse") != std::string::npos) {
-    fl_value_append_take(features, CreateStringValue("SSE"));
+  fl_value_set(deviceInfo, InternKey("securityInfo"), self->securityInfo);
+
+  char hostname[sizeof(self->hostname)] = {0};
+  gethostname(hostname, sizeof(hostname) - 1);
+  if (self->deviceName == nullptr || strcmp(hostname, self->hostname) != 0) {
+    g_clear_pointer(&self->deviceName, fl_value_unref);
+    self->deviceName = fl_value_new_string(hostname);
+    memcpy(self->hostname, hostname, sizeof(hostname));
   }
-  if (cpuinfo.find("sse2") != std::string::npos) {
-    fl_value_append_take(features, CreateStringValue("SSE2"));
+  fl_value_set(deviceInfo, InternKey("deviceName"), self->deviceName);
+
+  if (self->displayInfo == nullptr) {
+    const MonitorInfo* primary = self->displayWatcher != nullptr
+                                     ? self->displayWatcher->Primary()
+                                     : nullptr;
+    self->displayInfo =
+        EncodeDisplayInfo(primary != nullptr
+                              ? DisplayCollector::Summarize(*primary)
+                              : DisplayCollector().Collect());
   }
-  if (cpuinfo.find("sse4") != std::string::npos) {
-    fl_value_append_take(features, CreateStringValue("SSE4"));
+  fl_value_set(deviceInfo, InternKey("displayInfo"), self->displayInfo);
+
+  SetMapValue(deviceInfo, "memoryInfo",
+              EncodeMemoryInfo(live.memory, live.storage));
+  return deviceInfo;
+}
+
+// Encode battery info
+static FlValue* EncodeBatteryInfo(const BatteryInfo& info) {
+  if (!info.present) {
+    // No battery (desktop) - return null
+    return nullptr;
   }
-  
-  return features;
+
+  FlValue* batteryInfo = CreateMapValue();
+  SetMapValue(batteryInfo, "batteryLevel", CreateIntValue(info.batteryLevel));
+  SetMapValue(batteryInfo, "chargingStatus", CreateStringValue(info.chargingStatus));
+  SetMapValue(batteryInfo, "batteryHealth", CreateStringValue(info.batteryHealth));
+  SetMapValue(batteryInfo, "batteryCapacity", CreateIntValue(info.batteryCapacity));
+  SetMapValue(batteryInfo, "batteryVoltage", CreateDoubleValue(info.batteryVoltage));
+  SetMapValue(batteryInfo, "batteryTemperature", CreateDoubleValue(info.batteryTemperature));
+  return batteryInfo;
 }
 
-// Get total physical memory
-static int64_t GetTotalPhysicalMemory() {
-  struct sysinfo info;
-  if (sysinfo(&info) == 0) {
-    return info.totalram * info.mem_unit;
+// Encode sensor info
+static FlValue* EncodeSensorInfo(const SensorInfo& info) {
+  FlValue* sensorInfo = CreateMapValue();
+  SetMapValue(sensorInfo, "availableSensors",
+              CreateStringListValue(info.availableSensors));
+  return sensorInfo;
+}
+
+// Encode network info
+static FlValue* EncodeNetworkInfo(const NetworkInfo& info) {
+  FlValue* networkInfo = CreateMapValue();
+  SetMapValue(networkInfo, "connectionType", CreateStringValue(info.connectionType));
+  SetMapValue(networkInfo, "networkSpeed", CreateStringValue(info.networkSpeed));
+  SetMapValue(networkInfo, "isConnected", CreateBoolValue(info.IsConnected()));
+  SetMapValue(networkInfo, "ipAddress", CreateStringValue(info.ipAddress));
+  SetMapValue(networkInfo, "macAddress", CreateStringValue(info.macAddress));
+  return networkInfo;
+}
+
+// Helper function to create FlValue list from ints
+static FlValue* CreateIntListValue(const std::vector<int>& values) {
+  FlValue* list = fl_value_new_list();
+  for (int value : values) {
+    fl_value_append_take(list, CreateIntValue(value));
   }
-  return 0;
+  return list;
 }
 
-// Get available physical memory
-static int64_t GetAvailablePhysicalMemory() {
-  struct sysinfo info;
-  if (sysinfo(&info) == 0) {
-    return info.freeram * info.mem_unit;
+// Get the DRM device inventory
+static FlValue* GetGpus(FlValue* args) {
+  bool refresh = false;
+  if (args != nullptr && fl_value_get_type(args) == FL_VALUE_TYPE_MAP) {
+    FlValue* value = fl_value_lookup_string(args, "refresh");
+    refresh = value != nullptr && fl_value_get_type(value) == FL_VALUE_TYPE_BOOL &&
+              fl_value_get_bool(value);
+  }
+
+  // The inventory is cached across calls; the collector re-reads it on refresh.
+  static GpuCollector collector;
+  FlValue* gpus = fl_value_new_list();
+  for (const auto& gpu : collector.Collect(refresh)) {
+    FlValue* entry = CreateMapValue();
+    SetMapValue(entry, "card", CreateStringValue(gpu.card));
+    SetMapValue(entry, "driver", CreateStringValue(gpu.driver));
+    SetMapValue(entry, "pciVendorId", CreateIntValue(gpu.pciVendorId));
+    SetMapValue(entry, "pciDeviceId", CreateIntValue(gpu.pciDeviceId));
+    SetMapValue(entry, "pciSlot", CreateStringValue(gpu.pciSlot));
+    SetMapValue(entry, "isBootVga", CreateBoolValue(gpu.isBootVga));
+    SetMapValue(entry, "vramTotal", CreateIntValue(gpu.vramTotal));
+    SetMapValue(entry, "currentClockMhz", CreateIntValue(gpu.currentClockMhz));
+    SetMapValue(entry, "maxClockMhz", CreateIntValue(gpu.maxClockMhz));
+    SetMapValue(entry, "renderNode", CreateStringValue(gpu.renderNode));
+    fl_value_append_take(gpus, entry);
   }
-  return 0;
+  return gpus;
 }
 
-// Get total storage space
-static int64_t GetTotalStorageSpace() {
-  struct statvfs stat;
-  if (statvfs("/", &stat) == 0) {
-    return stat.f_blocks * stat.f_frsize;
+// Get NUMA nodes, the affinity mask and isolated CPUs
+static FlValue* GetCpuTopology() {
+  CpuTopology topology = ProcessorCollector().CollectTopology();
+  FlValue* result = CreateMapValue();
+  SetMapValue(result, "onlineCpus", CreateIntListValue(topology.onlineCpus));
+  SetMapValue(result, "allowedCpus", CreateIntListValue(topology.allowedCpus));
+  SetMapValue(result, "isolatedCpus", CreateIntListValue(topology.isolatedCpus));
+
+  FlValue* nodes = fl_value_new_list();
+  for (const auto& node : topology.nodes) {
+    FlValue* entry = CreateMapValue();
+    SetMapValue(entry, "id", CreateIntValue(node.id));
+    SetMapValue(entry, "cpus", CreateIntListValue(node.cpus));
+    SetMapValue(entry, "totalMemory", CreateIntValue(node.totalMemory));
+    SetMapValue(entry, "freeMemory", CreateIntValue(node.freeMemory));
+    SetMapValue(entry, "distances", CreateIntListValue(node.distances));
+    fl_value_append_take(nodes, entry);
   }
-  return 0;
+  SetMapValue(result, "nodes", nodes);
+  return result;
 }
 
-// Get available storage space
-static int64_t GetAvailableStorageSpace() {
-  struct statvfs stat;
-  if (statvfs("/", &stat) == 0) {
-    return stat.f_bavail * stat.f_frsize;
+// Get the cgroup and affinity limits of this process
+static FlValue* GetResourceLimits(FlValue* args) {
+  bool refresh = false;
+  if (args != nullptr && fl_value_get_type(args) == FL_VALUE_TYPE_MAP) {
+    FlValue* value = fl_value_lookup_string(args, "refresh");
+    refresh = value != nullptr && fl_value_get_type(value) == FL_VALUE_TYPE_BOOL &&
+              fl_value_get_bool(value);
   }
-  return 0;
+
+  // Limits are cached across calls; the collector re-reads them on refresh.
+  static CgroupCollector collector;
+  ResourceLimits limits = collector.Collect(refresh);
+
+  FlValue* result = CreateMapValue();
+  SetMapValue(result, "cgroupVersion", CreateIntValue(limits.cgroupVersion));
+  SetMapValue(result, "cgroupPath", CreateStringValue(limits.cgroupPath));
+  SetMapValue(result, "onlineCpuCount", CreateIntValue(limits.onlineCpuCount));
+  SetMapValue(result, "allowedCpus", CreateIntListValue(limits.allowedCpus));
+  SetMapValue(result, "cpusetCpus", CreateIntListValue(limits.cpusetCpus));
+  SetMapValue(result, "cpuQuota", CreateDoubleValue(limits.cpuQuota));
+  SetMapValue(result, "effectiveCpuCount", CreateIntValue(limits.effectiveCpuCount));
+  SetMapValue(result, "memoryLimit", CreateIntValue(limits.memoryLimit));
+  SetMapValue(result, "effectiveMemory", CreateIntValue(limits.effectiveMemory));
+
+  FlValue* ioLimits = fl_value_new_list();
+  for (const auto& io : limits.ioLimits) {
+    FlValue* entry = CreateMapValue();
+    SetMapValue(entry, "device", CreateStringValue(io.device));
+    SetMapValue(entry, "readBps", CreateIntValue(io.readBps));
+    SetMapValue(entry, "writeBps", CreateIntValue(io.writeBps));
+    SetMapValue(entry, "readIops", CreateIntValue(io.readIops));
+    SetMapValue(entry, "writeIops", CreateIntValue(io.writeIops));
+    fl_value_append_take(ioLimits, entry);
+  }
+  SetMapValue(result, "ioLimits", ioLimits);
+  return result;
 }
 
-// Get IP address
-static std::string GetIPAddress() {
-  struct ifaddrs *ifaddr, *ifa;
-  std::string ipAddress = "unknown";
-  
-  if (getifaddrs(&ifaddr) == 0) {
-    for (ifa = ifaddr; ifa != NULL; ifa = ifa->ifa_next) {
-      if (ifa->ifa_addr == NULL) continue;
-      
-      if (ifa->ifa_addr->sa_family == AF_INET) {
-        char host[NI_MAXHOST];
-        if (getnameinfo(ifa->ifa_addr, sizeof(struct sockaddr_in),
-                       host, NI_MAXHOST, NULL, 0, NI_NUMERICHOST) == 0) {
-          std::string addr = host;
-          if (addr != "127.0.0.1" && addr.find("169.254") != 0) {
-            ipAddress = addr;
-            break;
-          }
-        }
-      }
+// Returns the rollups of one sampled metric as a packed Float64List of
+// [startMs, min, max, avg] buckets.
+static FlMethodResponse* GetHistory(FlValue* args) {
+  static const struct {
+    const char* name;
+    HistoryMetric metric;
+  } kMetrics[] = {
+      {"cpuUsage", HistoryMetric::kCpuUsage},
+      {"memoryUsage", HistoryMetric::kMemoryUsage},
+      {"availableMemory", HistoryMetric::kAvailableMemory},
+      {"availableStorage", HistoryMetric::kAvailableStorage},
+      {"batteryLevel", HistoryMetric::kBatteryLevel},
+  };
+
+  FlValue* name = nullptr;
+  FlValue* range = nullptr;
+  FlValue* resolutionMs = nullptr;
+  if (args != nullptr && fl_value_get_type(args) == FL_VALUE_TYPE_MAP) {
+    name = fl_value_lookup_string(args, "metric");
+    range = fl_value_lookup_string(args, "rangeMs");
+    resolutionMs = fl_value_lookup_string(args, "resolutionMs");
+  }
+  if (name == nullptr || fl_value_get_type(name) != FL_VALUE_TYPE_STRING ||
+      range == nullptr || fl_value_get_type(range) != FL_VALUE_TYPE_INT ||
+      resolutionMs == nullptr ||
+      fl_value_get_type(resolutionMs) != FL_VALUE_TYPE_INT) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "INVALID_ARGUMENT", "metric, rangeMs and resolutionMs are required",
+        nullptr));
+  }
+
+  const HistoryMetric* metric = nullptr;
+  for (const auto& entry : kMetrics) {
+    if (strcmp(entry.name, fl_value_get_string(name)) == 0) {
+      metric = &entry.metric;
     }
-    freeifaddrs(ifaddr);
-  }
-  
-  return ipAddress;
-}
-
-// Get MAC address
-static std::string GetMACAddress() {
-  struct ifaddrs *ifaddr, *ifa;
-  std::string macAddress = "unknown";
-  
-  if (getifaddrs(&ifaddr) == 0) {
-    for (ifa = ifaddr; ifa != NULL; ifa = ifa->ifa_next) {
-      if (ifa->ifa_addr == NULL) continue;
-      
-      if (ifa->ifa_addr->sa_family == AF_PACKET) {
-        struct sockaddr_ll *s = (struct sockaddr_ll*)ifa->ifa_addr;
-        if (s->sll_halen == 6) {
-          char mac[18];
-          sprintf(mac, "%02X:%02X:%02X:%02X:%02X:%02X",
-                  (unsigned char)s->sll_addr[0],
-                  (unsigned char)s->sll_addr[1],
-                  (unsigned char)s->sll_addr[2],
-                  (unsigned char)s->sll_addr[3],
-                  (unsigned char)s->sll_addr[4],
-                  (unsigned char)s->sll_addr[5]);
-          macAddress = mac;
-          break;
-        }
-      }
+  }
+  const HistoryResolution* resolution = nullptr;
+  static const HistoryResolution kResolutions[] = {
+      HistoryResolution::kOneSecond, HistoryResolution::kTenSeconds,
+      HistoryResolution::kOneMinute};
+  for (const auto& candidate : kResolutions) {
+    if (MetricHistory::ResolutionMs(candidate) == fl_value_get_int(resolutionMs)) {
+      resolution = &candidate;
     }
-    freeifaddrs(ifaddr);
   }
-  
-  return macAddress;
+  if (metric == nullptr || resolution == nullptr) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "INVALID_ARGUMENT", "Unknown metric or resolution", nullptr));
+  }
+
+  int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::system_clock::now().time_since_epoch())
+                      .count();
+  std::vector<double> buckets = SharedSampling::Instance().History().Query(
+      *metric, std::chrono::milliseconds(fl_value_get_int(range)), *resolution,
+      nowMs);
+  g_autoptr(FlValue) result =
+      fl_value_new_float_list(buckets.data(), buckets.size());
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
 }
 
-// Get device ID
-static std::string GetDeviceId() {
-  std::string machineId = ReadFile("/etc/machine-id");
-  if (!machineId.empty()) {
-    // remove new lines
-    machineId.erase(machineId.find_last_not_of(" \n\r\t") + 1);
-    return machineId;
+// Get the instrumentation counters
+static FlValue* GetPluginStats() {
+  PluginStats stats = ReadPluginStats();
+
+  FlValue* collectors = CreateMapValue();
+  for (int i = 0; i < static_cast<int>(StatCollector::kCount); ++i) {
+    const CollectorStats& collector = stats.collectors[i];
+    FlValue* entry = CreateMapValue();
+    SetMapValue(entry, "calls", CreateIntValue(collector.calls));
+    SetMapValue(entry, "totalNs", CreateIntValue(collector.totalNs));
+    SetMapValue(entry, "maxNs", CreateIntValue(collector.maxNs));
+    fl_value_set_string_take(collectors,
+                             StatCollectorName(static_cast<StatCollector>(i)),
+                             entry);
   }
-  return "unknown";
+
+  FlValue* caches = CreateMapValue();
+  for (int i = 0; i < static_cast<int>(StatCache::kCount); ++i) {
+    FlValue* entry = CreateMapValue();
+    SetMapValue(entry, "hits", CreateIntValue(stats.caches[i].hits));
+    SetMapValue(entry, "misses", CreateIntValue(stats.caches[i].misses));
+    SetMapValue(entry, "joins", CreateIntValue(stats.caches[i].joins));
+    fl_value_set_string_take(caches, StatCacheName(static_cast<StatCache>(i)),
+                             entry);
+  }
+
+  FlValue* result = CreateMapValue();
+  SetMapValue(result, "collectors", collectors);
+  SetMapValue(result, "caches", caches);
+  SetMapValue(result, "fileReads", CreateIntValue(stats.fileReads));
+  SetMapValue(result, "bytesRead", CreateIntValue(stats.bytesRead));
+  return result;
 }
 
-// Get device info
-static FlValue* GetDeviceInfo() {
-  FlValue* deviceInfo = CreateMapValue();
-  
-  SetMapValue(deviceInfo, "deviceId", CreateStringValue(GetDeviceId()));
-  
-  // Get hostname
-  char hostname[256];
-  gethostname(hostname, sizeof(hostname));
-  SetMapValue(deviceInfo, "deviceName", CreateStringValue(hostname));
-  
-  // Get system info
-  struct utsname unameInfo;
-  uname(&unameInfo);
-  
-  SetMapValue(deviceInfo, "manufacturer", CreateStringValue("Unknown"));
-  SetMapValue(deviceInfo, "model", CreateStringValue("Linux PC"));
-  SetMapValue(deviceInfo, "brand", CreateStringValue("Linux"));
-  SetMapValue(deviceInfo, "operatingSystem", CreateStringValue("Linux"));
-  SetMapValue(deviceInfo, "systemVersion", CreateStringValue(unameInfo.release));
-  SetMapValue(deviceInfo, "buildNumber", CreateStringValue(unameInfo.version));
-  SetMapValue(deviceInfo, "kernelVersion", CreateStringValue(unameInfo.release));
-  
-  // Processor info
-  FlValue* processorInfo = CreateMapValue();
-  SetMapValue(processorInfo, "architecture", CreateStringValue(GetProcessorArchitecture()));
-  SetMapValue(processorInfo, "coreCount", CreateIntValue(GetProcessorCoreCount()));
-  SetMapValue(processorInfo, "maxFrequency", CreateIntValue(GetProcessorMaxFrequency()));
-  SetMapValue(processorInfo, "processorName", CreateStringValue(GetProcessorName()));
-  SetMapValue(processorInfo, "features", GetProcessorFeatures());
-  SetMapValue(deviceInfo, "processorInfo", processorInfo);
-  
-  // Memory info
-  FlValue* memoryInfo = CreateMapValue();
-  int64_t totalMem = GetTotalPhysicalMemory();
-  int64_t availMem = GetAvailablePhysicalMemory();
-  int64_t totalStorage = GetTotalStorageSpace();
-  int64_t availStorage = GetAvailableStorageSpace();
-  
-  SetMapValue(memoryInfo, "totalPhysicalMemory", CreateIntValue(totalMem));
-  SetMapValue(memoryInfo, "availablePhysicalMemory", CreateIntValue(availMem));
-  SetMapValue(memoryInfo, "totalStorageSpace", CreateIntValue(totalStorage));
-  SetMapValue(memoryInfo, "availableStorageSpace", CreateIntValue(availStorage));
-  SetMapValue(memoryInfo, "usedStorageSpace", CreateIntValue(totalStorage - availStorage));
-  double memUsage = totalMem > 0 ? ((totalMem - availMem) * 100.0 / totalMem) : 0.0;
-  SetMapValue(memoryInfo, "memoryUsagePercentage", CreateDoubleValue(memUsage));
-  SetMapValue(deviceInfo, "memoryInfo", memoryInfo);
-  
-  // Display info (approximate)
-  FlValue* displayInfo = CreateMapValue();
-  SetMapValue(displayInfo, "screenWidth", CreateIntValue(1920));
-  SetMapValue(displayInfo, "screenHeight", CreateIntValue(1080));
-  SetMapValue(displayInfo, "pixelDensity", CreateDoubleValue(1.0));
-  SetMapValue(displayInfo, "refreshRate", CreateDoubleValue(60.0));
-  SetMapValue(displayInfo, "screenSizeInches", CreateDoubleValue(24.0));
-  SetMapValue(displayInfo, "orientation", CreateStringValue("landscape"));
-  SetMapValue(displayInfo, "isHdr", CreateBoolValue(false));
-  SetMapValue(deviceInfo, "displayInfo", displayInfo);
-  
-  // Security info
-  FlValue* securityInfo = CreateMapValue();
-  SetMapValue(securityInfo, "isDeviceSecure", CreateBoolValue(true));
-  SetMapValue(securityInfo, "hasFingerprint", CreateBoolValue(false));
-  SetMapValue(securityInfo, "hasFaceUnlock", CreateBoolValue(false));
-  SetMapValue(securityInfo, "screenLockEnabled", CreateBoolValue(true));
-  SetMapValue(securityInfo, "encryptionStatus", CreateStringValue("unknown"));
-  SetMapValue(deviceInfo, "securityInfo", securityInfo);
-  
-  return deviceInfo;
+// How long a coalesced query result is reused by default.
+static const std::chrono::milliseconds kDefaultFreshnessWindow(250);
+
+// Default period of the shared sampler when Dart doesn't pass one.
+static const int64_t kDefaultSharedSamplingIntervalMs = 1000;
+
+// A startSharedSampling or stopSharedSampling call. They run one at a time
+// on a worker thread, in the order they arrived, because starting takes the
+// first sample and stopping joins the sampler thread.
+struct SamplingRequest {
+  FlMethodCall* call;
+  // Zero for stopSharedSampling.
+  std::chrono::milliseconds interval;
+  bool started = false;
+};
+
+static void RunSamplingRequest(GTask* task, gpointer source, gpointer data,
+                               GCancellable* cancellable) {
+  SamplingRequest* request = static_cast<SamplingRequest*>(data);
+  SharedSampling& sampling = SharedSampling::Instance();
+  if (request->interval.count() > 0) {
+    request->started = sampling.Start(request->interval);
+  } else {
+    sampling.Stop();
+  }
+  g_task_return_boolean(task, TRUE);
 }
 
-// Get battery info
-static FlValue* GetBatteryInfo() {
-  FlValue* batteryInfo = CreateMapValue();
-  
-  // Try to read battery info from /sys/class/power_supply
-  std::string batteryPath = "/sys/class/power_supply/BAT0";
-  std::string capacity = ReadFile(batteryPath + "/capacity");
-  std::string status = ReadFile(batteryPath + "/status");
-  
-  if (!capacity.empty()) {
-    int level = std::stoi(capacity);
-    SetMapValue(batteryInfo, "batteryLevel", CreateIntValue(level));
-    
-    std::string chargingStatus = "unknown";
-    if (!status.empty()) {
-      if (status.find("Charging") != std::string::npos) {
-        chargingStatus = "charging";
-      } else if (status.find("Full") != std::string::npos) {
-        chargingStatus = "full";
-      } else {
-        chargingStatus = "discharging";
-      }
-    }
-    SetMapValue(batteryInfo, "chargingStatus", CreateStringValue(chargingStatus));
-    SetMapValue(batteryInfo, "batteryHealth", CreateStringValue("good"));
-    SetMapValue(batteryInfo, "batteryCapacity", CreateIntValue(0));
-    SetMapValue(batteryInfo, "batteryVoltage", CreateDoubleValue(0.0));
-    SetMapValue(batteryInfo, "batteryTemperature", CreateDoubleValue(0.0));
-    return batteryInfo;
+static void RunNextSamplingRequest(FlutterDeviceInfoPlusPlugin* self);
+
+static void OnSamplingRequestDone(GObject* source, GAsyncResult* result,
+                                  gpointer user_data) {
+  FlutterDeviceInfoPlusPlugin* self = FLUTTER_DEVICE_INFO_PLUS_PLUGIN(source);
+  SamplingRequest* request =
+      static_cast<SamplingRequest*>(g_task_get_task_data(G_TASK(result)));
+
+  g_autoptr(FlMethodResponse) response = nullptr;
+  if (request->interval.count() == 0) {
+    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+  } else if (!request->started) {
+    response = FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "UNAVAILABLE", "Failed to create the shared snapshot ring", nullptr));
   } else {
-    // No battery (desktop) - return null
-    fl_value_unref(batteryInfo);
-    return nullptr;
+    g_autoptr(FlValue) value = CreateMapValue();
+    SetMapValue(value, "ringName",
+                CreateStringValue(SharedSampling::Instance().RingName()));
+    response = FL_METHOD_RESPONSE(fl_method_success_response_new(value));
   }
+  fl_method_call_respond(request->call, response, nullptr);
+
+  self->samplingRequestRunning = FALSE;
+  RunNextSamplingRequest(self);
 }
 
-// Get sensor info
-static FlValue* GetSensorInfo() {
-  FlValue* sensorInfo = CreateMapValue();
-  FlValue* sensors = fl_value_new_list();
-  
-  // Check for available sensors in /sys/bus/iio/devices
-  fl_value_append_take(sensors, CreateStringValue("accelerometer")); // If available
-  
-  SetMapValue(sensorInfo, "availableSensors", sensors);
-  return sensorInfo;
+static void RunNextSamplingRequest(FlutterDeviceInfoPlusPlugin* self) {
+  if (self->samplingRequestRunning || self->samplingRequests->empty()) {
+    return;
+  }
+  SamplingRequest* request = self->samplingRequests->front();
+  self->samplingRequests->pop_front();
+  self->samplingRequestRunning = TRUE;
+
+  // The task keeps the plugin alive until the request was answered.
+  GTask* task = g_task_new(self, nullptr, OnSamplingRequestDone, nullptr);
+  g_task_set_task_data(task, request, [](gpointer data) {
+    SamplingRequest* request = static_cast<SamplingRequest*>(data);
+    g_object_unref(request->call);
+    delete request;
+  });
+  g_task_run_in_thread(task, RunSamplingRequest);
+  g_object_unref(task);
 }
 
-// Get network info
-static FlValue* GetNetworkInfo() {
-  FlValue* networkInfo = CreateMapValue();
-  
-  std::string ipAddress = GetIPAddress();
-  std::string macAddress = GetMACAddress();
-  
-  SetMapValue(networkInfo, "connectionType", CreateStringValue("ethernet"));
-  SetMapValue(networkInfo, "networkSpeed", CreateStringValue("Unknown"));
-  SetMapValue(
-      networkInfo,
-      "isConnected",
-      CreateBoolValue(!ipAddress.empty() && ipAddress != "unknown"));
-  SetMapValue(networkInfo, "ipAddress", CreateStringValue(ipAddress));
-  SetMapValue(networkInfo, "macAddress", CreateStringValue(macAddress));
-  
-  return networkInfo;
+// Queues |method_call| to start (|interval| > 0) or stop the shared sampler.
+static void QueueSamplingRequest(FlutterDeviceInfoPlusPlugin* self,
+                                 FlMethodCall* method_call,
+                                 std::chrono::milliseconds interval) {
+  self->samplingRequests->push_back(new SamplingRequest{
+      FL_METHOD_CALL(g_object_ref(method_call)), interval});
+  RunNextSamplingRequest(self);
+}
+
+// Starts publishing samples into the shared snapshot ring. Responds once
+// the first sample was published.
+static FlMethodResponse* StartSharedSampling(FlutterDeviceInfoPlusPlugin* self,
+                                             FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  int64_t intervalMs = kDefaultSharedSamplingIntervalMs;
+  if (args != nullptr && fl_value_get_type(args) == FL_VALUE_TYPE_MAP) {
+    FlValue* interval = fl_value_lookup_string(args, "intervalMs");
+    if (interval != nullptr && fl_value_get_type(interval) == FL_VALUE_TYPE_INT) {
+      intervalMs = fl_value_get_int(interval);
+    }
+  }
+  if (intervalMs <= 0) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "INVALID_ARGUMENT", "intervalMs must be positive", nullptr));
+  }
+
+  QueueSamplingRequest(self, method_call,
+                       std::chrono::milliseconds(intervalMs));
+  return nullptr;
+}
+
+// Sets how long coalesced query results are reused.
+static FlMethodResponse* SetFreshnessWindow(FlutterDeviceInfoPlusPlugin* self,
+                                            FlValue* args) {
+  FlValue* window = args != nullptr && fl_value_get_type(args) == FL_VALUE_TYPE_MAP
+                        ? fl_value_lookup_string(args, "windowMs")
+                        : nullptr;
+  if (window == nullptr || fl_value_get_type(window) != FL_VALUE_TYPE_INT ||
+      fl_value_get_int(window) < 0) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "INVALID_ARGUMENT", "windowMs must be a non-negative integer", nullptr));
+  }
+  self->coalescer->SetFreshness(std::chrono::milliseconds(fl_value_get_int(window)));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
 }
 
 // Called when a method call is received from Flutter.
@@ -416,26 +677,69 @@ static void flutter_device_info_plus_plugin_handle_method_call(
 
   const gchar* method = fl_method_call_get_name(method_call);
 
+  // The collector queries are coalesced: they respond asynchronously,
+  // sharing one collection on a worker thread between identical calls.
   if (strcmp(method, "getDeviceInfo") == 0) {
-    FlValue* result = GetDeviceInfo();
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
-    fl_value_unref(result);
+    bool needsProfile = self->deviceInfoTemplate == nullptr;
+    self->coalescer->Handle(method, method_call, [self, needsProfile]() {
+      LiveDeviceInfo live = CollectLiveDeviceInfo(needsProfile);
+      return RequestCoalescer::Encoder(
+          [self, live]() { return GetDeviceInfo(self, live); });
+    });
+    return;
   } else if (strcmp(method, "getBatteryInfo") == 0) {
-    FlValue* result = GetBatteryInfo();
-    if (result != nullptr) {
-      response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
-      fl_value_unref(result);
-    } else {
-      response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
-    }
+    self->coalescer->Handle(method, method_call, []() {
+      BatteryInfo info = BatteryCollector().Collect();
+      return RequestCoalescer::Encoder(
+          [info]() { return EncodeBatteryInfo(info); });
+    });
+    return;
   } else if (strcmp(method, "getSensorInfo") == 0) {
-    FlValue* result = GetSensorInfo();
+    self->coalescer->Handle(method, method_call, []() {
+      SensorInfo info = SensorCollector().Collect();
+      return RequestCoalescer::Encoder(
+          [info]() { return EncodeSensorInfo(info); });
+    });
+    return;
+  } else if (strcmp(method, "getNetworkInfo") == 0) {
+    self->coalescer->Handle(method, method_call, []() {
+      NetworkInfo info = NetworkCollector().Collect();
+      return RequestCoalescer::Encoder(
+          [info]() { return EncodeNetworkInfo(info); });
+    });
+    return;
+  } else if (strcmp(method, "setFreshnessWindow") == 0) {
+    response = SetFreshnessWindow(self, fl_method_call_get_args(method_call));
+  } else if (strcmp(method, "getMonitors") == 0) {
+    FlValue* result = GetMonitors(self);
     response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
     fl_value_unref(result);
-  } else if (strcmp(method, "getNetworkInfo") == 0) {
-    FlValue* result = GetNetworkInfo();
+  } else if (strcmp(method, "getHistory") == 0) {
+    response = GetHistory(fl_method_call_get_args(method_call));
+  } else if (strcmp(method, "getPluginStats") == 0) {
+    FlValue* result = GetPluginStats();
+    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+    fl_value_unref(result);
+  } else if (strcmp(method, "getGpus") == 0) {
+    FlValue* result = GetGpus(fl_method_call_get_args(method_call));
+    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+    fl_value_unref(result);
+  } else if (strcmp(method, "getCpuTopology") == 0) {
+    FlValue* result = GetCpuTopology();
+    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+    fl_value_unref(result);
+  } else if (strcmp(method, "getResourceLimits") == 0) {
+    FlValue* result = GetResourceLimits(fl_method_call_get_args(method_call));
     response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
     fl_value_unref(result);
+  } else if (strcmp(method, "startSharedSampling") == 0) {
+    response = StartSharedSampling(self, method_call);
+    if (response == nullptr) {
+      return;
+    }
+  } else if (strcmp(method, "stopSharedSampling") == 0) {
+    QueueSamplingRequest(self, method_call, std::chrono::milliseconds(0));
+    return;
   } else {
     response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
   }
@@ -444,6 +748,25 @@ static void flutter_device_info_plus_plugin_handle_method_call(
 }
 
 static void flutter_device_info_plus_plugin_dispose(GObject* object) {
+  FlutterDeviceInfoPlusPlugin* self = FLUTTER_DEVICE_INFO_PLUS_PLUGIN(object);
+  delete self->displayWatcher;
+  self->displayWatcher = nullptr;
+  delete self->coalescer;
+  self->coalescer = nullptr;
+  // Empty: each queued request runs once the one before it is answered,
+  // and the running one holds a reference to the plugin.
+  delete self->samplingRequests;
+  self->samplingRequests = nullptr;
+  g_clear_object(&self->monitorChannel);
+  g_clear_pointer(&self->deviceInfoTemplate, fl_value_unref);
+  g_clear_pointer(&self->processorInfoTemplate, fl_value_unref);
+  g_clear_pointer(&self->processorInfo, fl_value_unref);
+  g_clear_pointer(&self->securityInfo, fl_value_unref);
+  delete self->security;
+  self->security = nullptr;
+  g_clear_pointer(&self->displayInfo, fl_value_unref);
+  g_clear_pointer(&self->deviceName, fl_value_unref);
+
   G_OBJECT_CLASS(flutter_device_info_plus_plugin_parent_class)->dispose(object);
 }
 
@@ -451,7 +774,104 @@ static void flutter_device_info_plus_plugin_class_init(FlutterDeviceInfoPlusPlug
   G_OBJECT_CLASS(klass)->dispose = flutter_device_info_plus_plugin_dispose;
 }
 
-static void flutter_device_info_plus_plugin_init(FlutterDeviceInfoPlusPlugin* self) {}
+static void flutter_device_info_plus_plugin_init(FlutterDeviceInfoPlusPlugin* self) {
+  self->displayWatcher = nullptr;
+  self->monitorChannel = nullptr;
+  self->monitorsListening = FALSE;
+  self->coalescer = new RequestCoalescer(kDefaultFreshnessWindow);
+  self->samplingRequests = new std::deque<SamplingRequest*>();
+  self->samplingRequestRunning = FALSE;
+  self->deviceInfoTemplate = nullptr;
+  self->processorInfoTemplate = nullptr;
+  self->processorInfo = nullptr;
+  self->coreCount = 0;
+  self->securityInfo = nullptr;
+  self->security = new SecurityInfo();
+  self->displayInfo = nullptr;
+  self->deviceName = nullptr;
+  self->hostname[0] = '\0';
+}
+
+// Pushes the current monitor list to Dart when it changes.
+static void SendMonitors(FlutterDeviceInfoPlusPlugin* self) {
+  if (!self->monitorsListening || self->monitorChannel == nullptr) {
+    return;
+  }
+  g_autoptr(FlValue) monitors = GetMonitors(self);
+  fl_event_channel_send(self->monitorChannel, monitors, nullptr, nullptr);
+}
+
+// Called by the display watcher after monitors were added, removed or
+// reconfigured.
+static void OnMonitorsChanged(FlutterDeviceInfoPlusPlugin* self) {
+  g_clear_pointer(&self->displayInfo, fl_value_unref);
+  self->coalescer->Invalidate();
+  SendMonitors(self);
+}
+
+static FlMethodErrorResponse* monitors_listen_cb(FlEventChannel* channel,
+                                                 FlValue* args,
+                                                 gpointer user_data) {
+  FlutterDeviceInfoPlusPlugin* self = FLUTTER_DEVICE_INFO_PLUS_PLUGIN(user_data);
+  self->monitorsListening = TRUE;
+  SendMonitors(self);
+  return nullptr;
+}
+
+static FlMethodErrorResponse* monitors_cancel_cb(FlEventChannel* channel,
+                                                 FlValue* args,
+                                                 gpointer user_data) {
+  FlutterDeviceInfoPlusPlugin* self = FLUTTER_DEVICE_INFO_PLUS_PLUGIN(user_data);
+  self->monitorsListening = FALSE;
+  return nullptr;
+}
+
+// Pauses shared sampling while the Flutter window is hidden, minimized or
+// unfocused, so continuous monitoring costs nothing in the background.
+static void UpdateForeground(GtkWidget* window) {
+  bool visible = gtk_widget_get_mapped(window);
+  GdkWindow* gdkWindow = gtk_widget_get_window(window);
+  if (gdkWindow != nullptr &&
+      (gdk_window_get_state(gdkWindow) &
+       (GDK_WINDOW_STATE_ICONIFIED | GDK_WINDOW_STATE_WITHDRAWN)) != 0) {
+    visible = false;
+  }
+  bool active = gtk_window_is_active(GTK_WINDOW(window));
+  SharedSampling::Instance().SetForeground(visible && active);
+}
+
+static void window_changed_cb(GtkWidget* window, gpointer user_data) {
+  UpdateForeground(window);
+}
+
+static void window_notify_cb(GObject* object, GParamSpec* pspec,
+                             gpointer user_data) {
+  UpdateForeground(GTK_WIDGET(object));
+}
+
+static gboolean window_state_cb(GtkWidget* window, GdkEventWindowState* event,
+                                gpointer user_data) {
+  UpdateForeground(window);
+  return FALSE;
+}
+
+static void WatchWindowState(FlPluginRegistrar* registrar) {
+  FlView* view = fl_plugin_registrar_get_view(registrar);
+  if (view == nullptr) {
+    // Headless engine; there is no window to follow.
+    return;
+  }
+  GtkWidget* window = gtk_widget_get_toplevel(GTK_WIDGET(view));
+  if (!GTK_IS_WINDOW(window)) {
+    return;
+  }
+  g_signal_connect(window, "notify::is-active", G_CALLBACK(window_notify_cb),
+                   nullptr);
+  g_signal_connect(window, "window-state-event", G_CALLBACK(window_state_cb),
+                   nullptr);
+  g_signal_connect(window, "map", G_CALLBACK(window_changed_cb), nullptr);
+  g_signal_connect(window, "unmap", G_CALLBACK(window_changed_cb), nullptr);
+}
 
 static void method_call_cb(FlMethodChannel* channel, FlMethodCall* method_call,
                            gpointer user_data) {
@@ -472,5 +892,22 @@ void flutter_device_info_plus_plugin_register_with_registrar(FlPluginRegistrar*
                                             g_object_ref(plugin),
                                             g_object_unref);
 
+  GdkDisplay* display = gdk_display_get_default();
+  if (display != nullptr) {
+    plugin->displayWatcher =
+        new DisplayWatcher(display, [plugin]() { OnMonitorsChanged(plugin); });
+  }
+  plugin->monitorChannel =
+      fl_event_channel_new(fl_plugin_registrar_get_messenger(registrar),
+                           "flutter_device_info_plus/monitors",
+                           FL_METHOD_CODEC(codec));
+  // The plugin outlives the handlers: it is kept alive by the method channel
+  // and releases the event channel in dispose.
+  fl_event_channel_set_stream_handlers(plugin->monitorChannel,
+                                       monitors_listen_cb, monitors_cancel_cb,
+                                       plugin, nullptr);
+
+  WatchWindowState(registrar);
+
   g_object_unref(plugin);
 }
@@ -0,0 +1,63 @@
+#ifndef FLUTTER_PLUGIN_FDIP_SNAPSHOT_RING_H_
+#define FLUTTER_PLUGIN_FDIP_SNAPSHOT_RING_H_
+
+// Layout of the shared-memory snapshot ring published by the Linux plugin.
+//
+// The region is created with shm_open() under the name returned by the
+// `startSharedSampling` method (by default
+// "/flutter_device_info_plus.<uid>.<pid>" of the writing process) and can be
+// mapped read-only by any process of the same user. There is a single writer,
+// whose pid is stored in |writer_pid|; the name is unlinked when it stops.
+// Each slot is protected by a sequence lock: |seq| is odd while the slot is
+// being written, so a reader copies the sample and retries if |seq| was odd
+// or changed during the copy. The most recent sample lives in
+// slot (write_count - 1) % capacity.
+//
+// This header is plain C so it can be used by helper processes that don't
+// link against Flutter.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FDIP_RING_MAGIC 0x50494446u /* "FDIP" */
+#define FDIP_RING_VERSION 1u
+#define FDIP_RING_CAPACITY 64u
+
+typedef struct fdip_sample {
+  uint64_t sequence;      /* 1-based index of the sample. */
+  int64_t timestamp_ms;   /* Milliseconds since the epoch. */
+  int64_t total_physical_memory;
+  int64_t available_physical_memory;
+  int64_t total_storage_space;
+  int64_t available_storage_space;
+  int32_t core_count;
+  int32_t max_frequency;
+  int32_t battery_level;  /* -1 when there is no battery. */
+  int32_t is_connected;
+} fdip_sample;
+
+typedef struct fdip_ring_slot {
+  uint64_t seq;
+  fdip_sample sample;
+  uint8_t reserved[56];   /* Pads the slot to two cache lines. */
+} fdip_ring_slot;
+
+typedef struct fdip_ring_header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t capacity;
+  uint32_t sample_size;
+  uint64_t write_count;   /* Number of samples published so far. */
+  uint32_t writer_pid;    /* Process publishing into the ring. */
+  uint8_t reserved[36];   /* Pads the header to one cache line. */
+  fdip_ring_slot slots[FDIP_RING_CAPACITY];
+} fdip_ring_header;
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  // FLUTTER_PLUGIN_FDIP_SNAPSHOT_RING_H_
@@ -0,0 +1,56 @@
+#ifndef FLUTTER_PLUGIN_FLUTTER_DEVICE_INFO_PLUS_FFI_H_
+#define FLUTTER_PLUGIN_FLUTTER_DEVICE_INFO_PLUS_FFI_H_
+
+// C functions exported by the Linux plugin for synchronous use from
+// dart:ffi. They never allocate and may be called from any isolate.
+
+#include <stdint.h>
+
+#include "fdip_snapshot_ring.h"
+
+#ifdef FLUTTER_PLUGIN_IMPL
+#define FDIP_EXPORT __attribute__((visibility("default")))
+#else
+#define FDIP_EXPORT
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct fdip_memory {
+  int64_t total_physical_memory;      /* Bytes. */
+  int64_t available_physical_memory;  /* Bytes. */
+} fdip_memory;
+
+typedef struct fdip_cpu_load {
+  double usage_percentage;  /* Busy time across all cores, 0-100. */
+  int32_t core_count;
+  int32_t reserved;
+} fdip_cpu_load;
+
+// Returns the number of online processor cores.
+FDIP_EXPORT int32_t fdip_get_core_count(void);
+
+// Fills |out| with the current physical memory figures. Returns 1 on
+// success, 0 on failure.
+FDIP_EXPORT int32_t fdip_get_memory(fdip_memory* out);
+
+// Fills |out| with the CPU utilisation since the previous call from any
+// caller in this process (since boot for the first call). Returns 1 on
+// success, 0 if /proc/stat couldn't be read.
+FDIP_EXPORT int32_t fdip_get_cpu_load(fdip_cpu_load* out);
+
+// Copies the newest sample published by shared sampling into |out|.
+// Returns 1 on success, 0 if shared sampling was never started.
+FDIP_EXPORT int32_t fdip_ring_read_latest(fdip_sample* out);
+
+// Copies the sample with the given sequence number into |out|. Returns 0 if
+// it hasn't been published yet or was already overwritten.
+FDIP_EXPORT int32_t fdip_ring_read(uint64_t sequence, fdip_sample* out);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  // FLUTTER_PLUGIN_FLUTTER_DEVICE_INFO_PLUS_FFI_H_
@@ -0,0 +1,106 @@
+#include "request_coalescer.h"
+
+#include <utility>
+
+#include "core/stats.h"
+
+namespace flutter_device_info_plus {
+
+RequestCoalescer::RequestCoalescer(std::chrono::milliseconds freshness)
+    : state_(std::make_shared<State>()) {
+  SetFreshness(freshness);
+}
+
+RequestCoalescer::~RequestCoalescer() {
+  state_->alive = false;
+  for (auto& entry : state_->entries) {
+    for (FlMethodCall* call : entry.second.waiting) {
+      // Answer, so the Dart future doesn't wait forever.
+      g_autoptr(FlMethodResponse) response =
+          FL_METHOD_RESPONSE(fl_method_error_response_new(
+              "CANCELLED", "The plugin was detached during the query",
+              nullptr));
+      fl_method_call_respond(call, response, nullptr);
+      g_object_unref(call);
+    }
+    if (entry.second.result != nullptr) {
+      fl_value_unref(entry.second.result);
+    }
+  }
+  state_->entries.clear();
+}
+
+void RequestCoalescer::SetFreshness(std::chrono::milliseconds freshness) {
+  state_->freshnessUs = freshness.count() > 0 ? freshness.count() * 1000 : 0;
+}
+
+void RequestCoalescer::Handle(const std::string& key, FlMethodCall* call,
+                              Collector collect) {
+  Entry& entry = state_->entries[key];
+  if (entry.cached &&
+      g_get_monotonic_time() - entry.completedUs < state_->freshnessUs) {
+    RecordCacheLookup(StatCache::kQueryResult, true);
+    fl_method_call_respond_success(call, entry.result, nullptr);
+    return;
+  }
+
+  entry.waiting.push_back(FL_METHOD_CALL(g_object_ref(call)));
+  if (entry.running) {
+    RecordCacheJoin(StatCache::kQueryResult);
+    return;
+  }
+  RecordCacheLookup(StatCache::kQueryResult, false);
+  entry.running = true;
+
+  // GLib's GTask pool is bounded and shared with the rest of the process;
+  // the callback runs on this (main) thread's context.
+  GTask* task = g_task_new(nullptr, nullptr, OnJobDone, nullptr);
+  g_task_set_task_data(task, new Job{state_, key, std::move(collect), {}},
+                       [](gpointer data) { delete static_cast<Job*>(data); });
+  g_task_run_in_thread(task, RunJob);
+  g_object_unref(task);
+}
+
+void RequestCoalescer::RunJob(GTask* task, gpointer source, gpointer data,
+                              GCancellable* cancellable) {
+  Job* job = static_cast<Job*>(data);
+  job->encode = job->collect();
+  g_task_return_boolean(task, TRUE);
+}
+
+void RequestCoalescer::OnJobDone(GObject* source, GAsyncResult* result,
+                                 gpointer user_data) {
+  Job* job = static_cast<Job*>(g_task_get_task_data(G_TASK(result)));
+  Complete(job->state, job->key, job->encode);
+}
+
+void RequestCoalescer::Invalidate() {
+  for (auto& entry : state_->entries) {
+    entry.second.cached = false;
+  }
+}
+
+void RequestCoalescer::Complete(const std::shared_ptr<State>& state,
+                                const std::string& key,
+                                const Encoder& encode) {
+  if (!state->alive) {
+    return;
+  }
+  Entry& entry = state->entries[key];
+  if (entry.result != nullptr) {
+    fl_value_unref(entry.result);
+  }
+  entry.result = encode();
+  entry.cached = true;
+  entry.running = false;
+  entry.completedUs = g_get_monotonic_time();
+
+  std::vector<FlMethodCall*> waiting;
+  waiting.swap(entry.waiting);
+  for (FlMethodCall* call : waiting) {
+    fl_method_call_respond_success(call, entry.result, nullptr);
+    g_object_unref(call);
+  }
+}
+
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,84 @@
+#ifndef FLUTTER_PLUGIN_REQUEST_COALESCER_H_
+#define FLUTTER_PLUGIN_REQUEST_COALESCER_H_
+
+#include <flutter_linux/flutter_linux.h>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace flutter_device_info_plus {
+
+// Deduplicates identical method calls. The first call for a key starts a
+// collection on GLib's shared GTask thread pool; calls for the same key that
+// arrive while it runs are answered with the same result, and calls within
+// the freshness window after it finished get the cached result directly.
+// Must be used on the GTK main thread.
+class RequestCoalescer {
+ public:
+  // Turns the collected data into the response. Runs on the main thread,
+  // so it may use GTK and plugin state. May return null.
+  using Encoder = std::function<FlValue*()>;
+  // Gathers the data on a worker thread and returns its encoder. Must not
+  // touch GTK or plugin state.
+  using Collector = std::function<Encoder()>;
+
+  explicit RequestCoalescer(std::chrono::milliseconds freshness);
+  // Pending calls are answered with a CANCELLED error; running collections
+  // finish in the background and are discarded.
+  ~RequestCoalescer();
+
+  // Disallow copy and assign.
+  RequestCoalescer(const RequestCoalescer&) = delete;
+  RequestCoalescer& operator=(const RequestCoalescer&) = delete;
+
+  // A zero window only coalesces calls that overlap a running collection.
+  void SetFreshness(std::chrono::milliseconds freshness);
+
+  // Responds to |call| now from the cache, or once the collection for |key|
+  // completes, starting one with |collect| if none is running.
+  void Handle(const std::string& key, FlMethodCall* call, Collector collect);
+
+  // Drops every cached result, e.g. after the plugin's state changed.
+  void Invalidate();
+
+ private:
+  struct Entry {
+    std::vector<FlMethodCall*> waiting;
+    bool running = false;
+    bool cached = false;
+    FlValue* result = nullptr;
+    gint64 completedUs = 0;
+  };
+
+  // Shared with workers so they can finish after the coalescer is gone.
+  struct State {
+    bool alive = true;
+    gint64 freshnessUs = 0;
+    std::map<std::string, Entry> entries;
+  };
+
+  // A collection in flight, owned by its GTask.
+  struct Job {
+    std::shared_ptr<State> state;
+    std::string key;
+    Collector collect;
+    Encoder encode;
+  };
+
+  static void RunJob(GTask* task, gpointer source, gpointer data,
+                     GCancellable* cancellable);
+  static void OnJobDone(GObject* source, GAsyncResult* result,
+                        gpointer user_data);
+  static void Complete(const std::shared_ptr<State>& state,
+                       const std::string& key, const Encoder& encode);
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_PLUGIN_REQUEST_COALESCER_H_
@@ -0,0 +1,115 @@
+#include "shared_sampling.h"
+
+#include <cstdlib>
+#include <utility>
+
+namespace flutter_device_info_plus {
+
+SharedSampling& SharedSampling::Instance() {
+  static SharedSampling* instance = new SharedSampling();
+  return *instance;
+}
+
+bool SharedSampling::Start(std::chrono::milliseconds interval) {
+  std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+  // Destroyed after |mutex_| is released, since that joins its thread.
+  std::unique_ptr<SnapshotSampler> replaced;
+  SnapshotSampler* sampler = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!ring_) {
+      static bool unlinkAtExit = [] {
+        // The instance is never destroyed, so remove the name explicitly.
+        atexit([] {
+          SharedSampling& self = Instance();
+          std::lock_guard<std::mutex> lock(self.mutex_);
+          if (self.ring_) self.ring_->Unlink();
+        });
+        return true;
+      }();
+      (void)unlinkAtExit;
+      RemoveStaleSnapshotRings();
+      ring_ = SnapshotRing::Create(DefaultSnapshotRingName());
+      if (!ring_) {
+        return false;
+      }
+      header_.store(ring_->header(), std::memory_order_release);
+    }
+
+    if (sampler_ && sampler_->interval() != interval) {
+      replaced = std::move(sampler_);
+    }
+    if (!sampler_) {
+      sampler_ = std::make_unique<SnapshotSampler>(interval);
+      sampler_->SetHistory(&history_);
+    }
+    if (sampler_->started()) {
+      return true;
+    }
+    // A stopped sampler is restarted into the current ring.
+    SnapshotRing* ring = ring_.get();
+    sampler_->SetListener(
+        [ring](const DeviceSnapshot& snapshot) { ring->Publish(snapshot); });
+    sampler = sampler_.get();
+  }
+  replaced.reset();
+
+  // The first pass reads every collector, so it runs without |mutex_| to
+  // keep SetForeground() from waiting on it. Pausing is safe at any point
+  // of the pass, and |sampler_| only changes under |lifecycleMutex_|.
+  sampler->Start();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!foreground_) {
+    sampler->Pause();
+  }
+  return true;
+}
+
+void SharedSampling::Stop() {
+  std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+  SnapshotSampler* sampler = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sampler = sampler_.get();
+    if (ring_) {
+      ring_->Unlink();
+      retired_.push_back(std::move(ring_));
+    }
+  }
+  // Joins the sampler thread, which may be running a task.
+  if (sampler != nullptr) {
+    sampler->Stop();
+  }
+}
+
+void SharedSampling::SetForeground(bool foreground) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (foreground_ == foreground) {
+    return;
+  }
+  foreground_ = foreground;
+  if (sampler_) {
+    if (foreground) {
+      sampler_->Resume();
+    } else {
+      sampler_->Pause();
+    }
+  }
+}
+
+std::string SharedSampling::RingName() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return ring_ ? ring_->name() : "";
+}
+
+bool SharedSampling::ReadLatest(fdip_sample* out) const {
+  const fdip_ring_header* header = header_.load(std::memory_order_acquire);
+  return header != nullptr && ReadLatestSample(header, out);
+}
+
+bool SharedSampling::Read(uint64_t sequence, fdip_sample* out) const {
+  const fdip_ring_header* header = header_.load(std::memory_order_acquire);
+  return header != nullptr && ReadSample(header, sequence, out);
+}
+
+}  // namespace flutter_device_info_plus
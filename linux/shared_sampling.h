@@ -0,0 +1,69 @@
+#ifndef FLUTTER_PLUGIN_SHARED_SAMPLING_H_
+#define FLUTTER_PLUGIN_SHARED_SAMPLING_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "core/metric_history.h"
+#include "core/snapshot.h"
+#include "core/snapshot_ring.h"
+
+namespace flutter_device_info_plus {
+
+// Process-wide sampler publishing into the shared snapshot ring. Shared by
+// the method channel handler, which starts and stops it, and the FFI
+// exports, which read from it on any isolate's thread.
+class SharedSampling {
+ public:
+  static SharedSampling& Instance();
+
+  // Starts sampling every |interval|, or changes the interval if already
+  // running. Returns false if the ring couldn't be created. Blocks while
+  // the first sample is taken, so the plugin calls it on a worker thread.
+  bool Start(std::chrono::milliseconds interval);
+
+  // Stops sampling and unlinks the ring's name. The last samples stay
+  // readable in this process; a later Start() publishes into a new ring.
+  void Stop();
+
+  // Pauses sampling while the app is in the background (hidden or
+  // unfocused) and resumes it, with a fresh sample, when it comes back.
+  void SetForeground(bool foreground);
+
+  // Name other processes can pass to shm_open(), empty for an anonymous ring
+  // or while stopped.
+  std::string RingName() const;
+
+  // Rollups of everything sampled since the first Start(). Kept across
+  // Stop() and Dart hot restarts.
+  const MetricHistory& History() const { return history_; }
+
+  // Lock-free; safe to call concurrently with Start() and Stop().
+  bool ReadLatest(fdip_sample* out) const;
+  bool Read(uint64_t sequence, fdip_sample* out) const;
+
+ private:
+  SharedSampling() = default;
+
+  // Serializes Start() and Stop(), which take the first sample and join the
+  // sampler thread without holding |mutex_|.
+  std::mutex lifecycleMutex_;
+  mutable std::mutex mutex_;
+  std::unique_ptr<SnapshotSampler> sampler_;
+  bool foreground_ = true;
+  // Created by Start(). Rings are intentionally kept mapped for the lifetime
+  // of the process, after Stop() in |retired_|, so readers never race with
+  // an unmap. Their names are unlinked on Stop() and at exit.
+  std::unique_ptr<SnapshotRing> ring_;
+  std::vector<std::unique_ptr<SnapshotRing>> retired_;
+  std::atomic<const fdip_ring_header*> header_{nullptr};
+  MetricHistory history_;
+};
+
+}  // namespace flutter_device_info_plus
+
+#endif  // FLUTTER_PLUGIN_SHARED_SAMPLING_H_
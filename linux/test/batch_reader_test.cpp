@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+
+#include "core/batch_reader.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+namespace {
+
+const std::string kFixtures = std::string(FDIP_TEST_FIXTURES) + "/batch_reader";
+
+void WriteFile(const std::string& path, const std::string& contents) {
+  FILE* file = fopen(path.c_str(), "w");
+  ASSERT_NE(file, nullptr);
+  fputs(contents.c_str(), file);
+  fclose(file);
+}
+
+// Reads the fixture files and a file rewritten between reads through
+// |reader|.
+void ExpectReads(BatchReader* reader) {
+  int capacity = reader->Add(kFixtures + "/capacity", 16);
+  int status = reader->Add(kFixtures + "/status", 32);
+  EXPECT_EQ(reader->Add(kFixtures + "/missing"), -1);
+  ASSERT_EQ(capacity, 0);
+  ASSERT_EQ(status, 1);
+
+  char path[] = "/tmp/fdip_batch_reader_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  WriteFile(path, "first");
+  // Only 3 bytes fit next to the terminator.
+  int changing = reader->Add(path, 4);
+
+  EXPECT_EQ(reader->ReadAll(), 3u);
+  EXPECT_STREQ(reader->Data(capacity), "87\n");
+  EXPECT_EQ(reader->Size(capacity), 3);
+  EXPECT_STREQ(reader->Data(status), "Discharging\n");
+  EXPECT_STREQ(reader->Data(changing), "fir");
+
+  // The files stay open and are read again from the start.
+  WriteFile(path, "next");
+  EXPECT_EQ(reader->ReadAll(), 3u);
+  EXPECT_STREQ(reader->Data(changing), "nex");
+  EXPECT_STREQ(reader->Data(capacity), "87\n");
+
+  unlink(path);
+  EXPECT_STREQ(reader->Data(-1), "");
+  EXPECT_EQ(reader->Size(3), -1);
+}
+
+}  // namespace
+
+TEST(BatchReader, ReadsWithPread) {
+  BatchReader reader(false);
+  ExpectReads(&reader);
+  EXPECT_FALSE(reader.UsingIoUring());
+}
+
+TEST(BatchReader, ReadsWithIoUring) {
+  BatchReader reader(true);
+  ExpectReads(&reader);
+  // Kernels before 5.1 and seccomp profiles (e.g. Docker's default) refuse
+  // io_uring; the reads above then went through the pread fallback.
+  if (!reader.UsingIoUring()) {
+    GTEST_SKIP() << "io_uring is unavailable; checked the pread fallback";
+  }
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
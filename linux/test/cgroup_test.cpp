@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "core/cgroup.h"
+#include "core/file_util.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+namespace {
+
+const std::string kFixtures = FDIP_TEST_FIXTURES;
+
+const IoLimit* FindIoLimit(const ResourceLimits& limits,
+                           const std::string& device) {
+  for (const auto& limit : limits.ioLimits) {
+    if (limit.device == device) {
+      return &limit;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(CgroupCollector, ParsesCpuLists) {
+  EXPECT_EQ(ParseCpuList("0-3,8,10-11\n"),
+            (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ(ParseCpuList("5"), (std::vector<int>{5}));
+  EXPECT_TRUE(ParseCpuList("").empty());
+}
+
+// Unified hierarchy: limits are the tightest along /user.slice/app.scope.
+TEST(CgroupCollector, ResolvesV2Hierarchy) {
+  CgroupCollector collector(kFixtures + "/cgroup_v2");
+  ResourceLimits limits = collector.Collect();
+
+  EXPECT_EQ(limits.cgroupVersion, 2);
+  EXPECT_EQ(limits.cgroupPath, "/user.slice/app.scope");
+  EXPECT_DOUBLE_EQ(limits.cpuQuota, 1.5);
+  EXPECT_EQ(limits.memoryLimit, int64_t{4294967296});
+  EXPECT_EQ(limits.cpusetCpus, (std::vector<int>{0, 1, 4}));
+  EXPECT_GE(limits.effectiveCpuCount, 1);
+  EXPECT_LE(limits.effectiveCpuCount, 2);
+
+  // user.slice throttles 8:0 too (tighter wiops, looser wbps) and 259:0,
+  // which app.scope doesn't mention.
+  ASSERT_EQ(limits.ioLimits.size(), 2u);
+  const IoLimit* io = FindIoLimit(limits, "8:0");
+  ASSERT_NE(io, nullptr);
+  EXPECT_EQ(io->readBps, -1);
+  EXPECT_EQ(io->writeBps, 1048576);
+  EXPECT_EQ(io->readIops, -1);
+  EXPECT_EQ(io->writeIops, 50);
+  const IoLimit* nvme = FindIoLimit(limits, "259:0");
+  ASSERT_NE(nvme, nullptr);
+  EXPECT_EQ(nvme->readBps, 10485760);
+  EXPECT_EQ(nvme->writeBps, -1);
+}
+
+// Hybrid v1 inside a container: the memory mount's root is the container's
+// cgroup and the cpuset path isn't visible, so both fall back to the mount
+// point.
+TEST(CgroupCollector, ResolvesV1HybridHierarchy) {
+  CgroupCollector collector(kFixtures + "/cgroup_v1");
+  ResourceLimits limits = collector.Collect();
+
+  EXPECT_EQ(limits.cgroupVersion, 1);
+  EXPECT_EQ(limits.cgroupPath, "/docker/abc");
+  EXPECT_DOUBLE_EQ(limits.cpuQuota, 0.5);
+  EXPECT_EQ(limits.effectiveCpuCount, 1);
+  EXPECT_EQ(limits.memoryLimit, int64_t{536870912});
+  EXPECT_EQ(limits.cpusetCpus, (std::vector<int>{0, 1, 2, 3}));
+
+  const IoLimit* io = FindIoLimit(limits, "8:0");
+  ASSERT_NE(io, nullptr);
+  EXPECT_EQ(io->readBps, 1048576);
+  EXPECT_EQ(io->writeBps, -1);
+  EXPECT_EQ(io->writeIops, 200);
+}
+
+TEST(CgroupCollector, ReportsNoLimitsWithoutCgroups) {
+  CgroupCollector collector(kFixtures + "/missing");
+  ResourceLimits limits = collector.Collect();
+
+  EXPECT_EQ(limits.cgroupVersion, 0);
+  EXPECT_EQ(limits.cpuQuota, 0.0);
+  EXPECT_EQ(limits.memoryLimit, -1);
+  EXPECT_TRUE(limits.ioLimits.empty());
+  // Falls back to the physical memory.
+  EXPECT_GT(limits.effectiveMemory, 0);
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/collectors.h"
+#include "core/edid.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+namespace {
+
+constexpr size_t kBlockSize = 128;
+
+void SetChecksum(uint8_t* block) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < kBlockSize - 1; ++i) {
+    sum = static_cast<uint8_t>(sum + block[i]);
+  }
+  block[kBlockSize - 1] = static_cast<uint8_t>(0x100 - sum);
+}
+
+// A 27" DELL U2720Q: EDID 1.4, 10-bit digital input, with a CTA-861
+// extension advertising PQ at 600 cd/m² when |hdr| is set.
+std::vector<uint8_t> MakeEdid(bool hdr) {
+  std::vector<uint8_t> edid(kBlockSize * (hdr ? 2 : 1), 0);
+  const uint8_t header[8] = {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+  std::copy(header, header + 8, edid.begin());
+  // "DEL": 00100 00101 01100.
+  edid[8] = 0x10;
+  edid[9] = 0xAC;
+  edid[10] = 0x7A;
+  edid[11] = 0xA1;
+  edid[18] = 1;
+  edid[19] = 4;
+  // Digital, 10 bits per channel (depth code 3).
+  edid[20] = 0x80 | (3 << 4);
+  edid[21] = 60;
+  edid[22] = 34;
+
+  uint8_t* name = &edid[54 + 18];
+  name[3] = 0xFC;
+  const char kName[] = "DELL U2720Q\n ";
+  std::copy(kName, kName + 13, name + 5);
+
+  edid[126] = hdr ? 1 : 0;
+  SetChecksum(edid.data());
+
+  if (hdr) {
+    uint8_t* cta = &edid[kBlockSize];
+    cta[0] = 0x02;
+    cta[1] = 3;
+    // Extended tag block of length 5: HDR static metadata, SDR + PQ,
+    // static metadata type 1, max luminance code 79 (~ 600 cd/m²).
+    cta[4] = (7 << 5) | 5;
+    cta[5] = 6;
+    cta[6] = 0x05;
+    cta[7] = 0x01;
+    cta[8] = 79;
+    cta[2] = 10;
+    SetChecksum(cta);
+  }
+  return edid;
+}
+
+DrmConnectorInfo MakeConnector(const std::string& name, bool connected,
+                               const std::string& productName) {
+  DrmConnectorInfo connector;
+  connector.name = name;
+  connector.connected = connected;
+  connector.hasEdid = true;
+  connector.edid.productName = productName;
+  connector.edid.bitDepth = 10;
+  return connector;
+}
+
+}  // namespace
+
+TEST(Edid, ParsesBaseBlock) {
+  std::vector<uint8_t> edid = MakeEdid(false);
+  EdidInfo info;
+  ASSERT_TRUE(ParseEdid(edid.data(), edid.size(), &info));
+  EXPECT_EQ(info.manufacturerId, "DEL");
+  EXPECT_EQ(info.productCode, 0xA17A);
+  EXPECT_EQ(info.productName, "DELL U2720Q");
+  EXPECT_EQ(info.widthCm, 60);
+  EXPECT_EQ(info.heightCm, 34);
+  EXPECT_EQ(info.bitDepth, 10);
+  EXPECT_FALSE(info.hdr);
+  EXPECT_EQ(info.maxLuminance, 0.0);
+}
+
+TEST(Edid, ParsesHdrStaticMetadata) {
+  std::vector<uint8_t> edid = MakeEdid(true);
+  EdidInfo info;
+  ASSERT_TRUE(ParseEdid(edid.data(), edid.size(), &info));
+  EXPECT_TRUE(info.hdr);
+  EXPECT_NEAR(info.maxLuminance, 50.0 * std::pow(2.0, 79 / 32.0), 0.01);
+}
+
+TEST(Edid, IgnoresMissingExtensionBlock) {
+  // The base block announces an extension that was cut off.
+  std::vector<uint8_t> edid = MakeEdid(true);
+  edid.resize(kBlockSize);
+  EdidInfo info;
+  ASSERT_TRUE(ParseEdid(edid.data(), edid.size(), &info));
+  EXPECT_EQ(info.manufacturerId, "DEL");
+  EXPECT_FALSE(info.hdr);
+}
+
+TEST(Edid, RejectsInvalidBlobs) {
+  EdidInfo info;
+  std::vector<uint8_t> edid = MakeEdid(false);
+  EXPECT_FALSE(ParseEdid(edid.data(), kBlockSize - 1, &info));
+
+  std::vector<uint8_t> badHeader = edid;
+  badHeader[0] = 0x01;
+  EXPECT_FALSE(ParseEdid(badHeader.data(), badHeader.size(), &info));
+
+  std::vector<uint8_t> badChecksum = edid;
+  badChecksum[kBlockSize - 1] ^= 0xFF;
+  EXPECT_FALSE(ParseEdid(badChecksum.data(), badChecksum.size(), &info));
+}
+
+TEST(Edid, AppliesAUniqueProductNameMatch) {
+  std::vector<DrmConnectorInfo> connectors = {
+      MakeConnector("HDMI-A-1", true, "LG ULTRAFINE"),
+      MakeConnector("DP-1", true, "DELL U2720Q"),
+  };
+  MonitorInfo monitor;
+  monitor.model = "DELL U2720Q";
+  DisplayCollector::ApplyEdid(connectors, 2, &monitor);
+  EXPECT_EQ(monitor.name, "DP-1");
+  EXPECT_EQ(monitor.bitDepth, 10);
+}
+
+TEST(Edid, IgnoresAProductNameSharedByIdenticalMonitors) {
+  std::vector<DrmConnectorInfo> connectors = {
+      MakeConnector("DP-1", true, "DELL U2720Q"),
+      MakeConnector("DP-2", true, "DELL U2720Q"),
+  };
+  MonitorInfo monitor;
+  monitor.model = "DELL U2720Q";
+  DisplayCollector::ApplyEdid(connectors, 2, &monitor);
+  EXPECT_EQ(monitor.name, "");
+  EXPECT_EQ(monitor.bitDepth, 0);
+
+  // A single monitor still gets the only connected display.
+  connectors[1].connected = false;
+  DisplayCollector::ApplyEdid(connectors, 1, &monitor);
+  EXPECT_EQ(monitor.name, "DP-1");
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
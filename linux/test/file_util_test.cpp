@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+
+#include "core/file_util.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+TEST(FileUtil, ReadsWholeFiles) {
+  char path[] = "/tmp/fdip_file_util_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  // Larger than any single read buffer.
+  std::string contents(20000, 'x');
+  contents += "\nend\n";
+  std::ofstream(path) << contents;
+
+  EXPECT_EQ(ReadFile(path), contents);
+  unlink(path);
+  EXPECT_EQ(ReadFile(path), "");
+}
+
+TEST(FileUtil, ReadsIntoCallerBuffers) {
+  char path[] = "/tmp/fdip_file_util_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  std::ofstream(path) << "MemTotal: 16318480 kB\n";
+
+  char buffer[64];
+  ASSERT_EQ(ReadFileInto(path, buffer, sizeof(buffer)), 22);
+  EXPECT_STREQ(buffer, "MemTotal: 16318480 kB\n");
+
+  // Truncates to the buffer and still NUL-terminates.
+  char small[9];
+  ASSERT_EQ(ReadFileInto(path, small, sizeof(small)), 8);
+  EXPECT_STREQ(small, "MemTotal");
+
+  EXPECT_EQ(ReadFileInto(path, buffer, 0), -1);
+  unlink(path);
+  EXPECT_EQ(ReadFileInto(path, buffer, sizeof(buffer)), -1);
+}
+
+TEST(FileUtil, TrimsWhitespace) {
+  EXPECT_EQ(Trim("  4096\n"), "4096");
+  EXPECT_EQ(Trim("\tmax \t"), "max");
+  EXPECT_EQ(Trim(" \n"), "");
+  EXPECT_EQ(Trim(""), "");
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "core/collectors.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+TEST(GpuCollector, EnumeratesDrmCards) {
+  GpuCollector collector(std::string(FDIP_TEST_FIXTURES) + "/drm");
+  std::vector<GpuInfo> gpus = collector.Collect();
+
+  // Connectors such as card0-DP-1 are skipped.
+  ASSERT_EQ(gpus.size(), 2u);
+
+  const GpuInfo& amd = gpus[0];
+  EXPECT_EQ(amd.card, "card0");
+  EXPECT_EQ(amd.driver, "amdgpu");
+  EXPECT_EQ(amd.pciVendorId, 0x1002);
+  EXPECT_EQ(amd.pciDeviceId, 0x73BF);
+  EXPECT_EQ(amd.pciSlot, "0000:03:00.0");
+  EXPECT_TRUE(amd.isBootVga);
+  EXPECT_EQ(amd.vramTotal, int64_t{17163091968});
+  EXPECT_EQ(amd.currentClockMhz, 1800);
+  EXPECT_EQ(amd.maxClockMhz, 2575);
+  EXPECT_EQ(amd.renderNode, "/dev/dri/renderD128");
+
+  const GpuInfo& intel = gpus[1];
+  EXPECT_EQ(intel.card, "card1");
+  EXPECT_EQ(intel.driver, "i915");
+  EXPECT_EQ(intel.pciVendorId, 0x8086);
+  EXPECT_FALSE(intel.isBootVga);
+  EXPECT_EQ(intel.vramTotal, 0);
+  EXPECT_EQ(intel.currentClockMhz, 300);
+  EXPECT_EQ(intel.maxClockMhz, 1300);
+  EXPECT_EQ(intel.renderNode, "/dev/dri/renderD129");
+}
+
+TEST(GpuCollector, ReturnsNothingWithoutDrm) {
+  GpuCollector collector(std::string(FDIP_TEST_FIXTURES) + "/missing");
+  EXPECT_TRUE(collector.Collect().empty());
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+
+#include "core/hardware_profile.h"
+#include "core/stats.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+namespace {
+
+class HardwareProfileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    char directory[] = "/tmp/fdip_profile_XXXXXX";
+    ASSERT_NE(mkdtemp(directory), nullptr);
+    directory_ = directory;
+    path_ = directory_ + "/cache/flutter_device_info_plus/profile.bin";
+  }
+
+  void TearDown() override {
+    unlink(path_.c_str());
+    rmdir((directory_ + "/cache/flutter_device_info_plus").c_str());
+    rmdir((directory_ + "/cache").c_str());
+    rmdir(directory_.c_str());
+  }
+
+  HardwareProfile MakeProfile() {
+    HardwareProfile profile;
+    profile.system.deviceId = "0123456789abcdef";
+    profile.system.manufacturer = "LENOVO";
+    profile.system.model = "ThinkPad X1 Carbon";
+    profile.system.kernelVersion = "6.8.0";
+    profile.processor.architecture = "x86_64";
+    profile.processor.coreCount = 8;
+    profile.processor.maxFrequency = 4800;
+    profile.processor.processorName = "Intel(R) Core(TM) i7-1365U";
+    profile.processor.features = {"sse4_2", "avx2", "aes"};
+    return profile;
+  }
+
+  uint64_t ProfileHits() {
+    return ReadPluginStats()
+        .caches[static_cast<int>(StatCache::kHardwareProfile)]
+        .hits;
+  }
+
+  std::string directory_;
+  std::string path_;
+};
+
+}  // namespace
+
+TEST_F(HardwareProfileTest, RoundTripsThroughTheFile) {
+  HardwareProfile saved = MakeProfile();
+  // Creates the missing parent directories.
+  ASSERT_TRUE(SaveHardwareProfile(path_, saved));
+
+  HardwareProfile loaded;
+  ASSERT_TRUE(LoadHardwareProfile(path_, &loaded));
+  EXPECT_EQ(loaded.system.deviceId, saved.system.deviceId);
+  EXPECT_EQ(loaded.system.manufacturer, saved.system.manufacturer);
+  EXPECT_EQ(loaded.system.model, saved.system.model);
+  EXPECT_EQ(loaded.system.kernelVersion, saved.system.kernelVersion);
+  EXPECT_EQ(loaded.processor.architecture, saved.processor.architecture);
+  EXPECT_EQ(loaded.processor.coreCount, 8);
+  EXPECT_EQ(loaded.processor.maxFrequency, 4800);
+  EXPECT_EQ(loaded.processor.processorName, saved.processor.processorName);
+  EXPECT_EQ(loaded.processor.features, saved.processor.features);
+}
+
+TEST_F(HardwareProfileTest, RejectsMissingAndCorruptFiles) {
+  HardwareProfile loaded;
+  EXPECT_FALSE(LoadHardwareProfile(path_, &loaded));
+  EXPECT_FALSE(LoadHardwareProfile("", &loaded));
+
+  ASSERT_TRUE(SaveHardwareProfile(path_, MakeProfile()));
+  {
+    // Flip a payload byte so the checksum no longer matches.
+    std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(20);
+    char byte = 0;
+    file.get(byte);
+    file.seekp(20);
+    file.put(static_cast<char>(byte ^ 0x5A));
+  }
+  EXPECT_FALSE(LoadHardwareProfile(path_, &loaded));
+
+  // A truncated file is rejected too.
+  ASSERT_TRUE(SaveHardwareProfile(path_, MakeProfile()));
+  ASSERT_EQ(truncate(path_.c_str(), 24), 0);
+  EXPECT_FALSE(LoadHardwareProfile(path_, &loaded));
+}
+
+TEST_F(HardwareProfileTest, CollectsOnceAndThenLoads) {
+  uint64_t hits = ProfileHits();
+  HardwareProfile collected = LoadOrCollectHardwareProfile(path_);
+  EXPECT_EQ(ProfileHits(), hits);
+  EXPECT_EQ(access(path_.c_str(), R_OK), 0);
+
+  HardwareProfile loaded = LoadOrCollectHardwareProfile(path_);
+  EXPECT_EQ(ProfileHits(), hits + 1);
+  EXPECT_EQ(loaded.system.kernelVersion, collected.system.kernelVersion);
+  EXPECT_EQ(loaded.processor.processorName, collected.processor.processorName);
+  EXPECT_EQ(loaded.processor.features, collected.processor.features);
+  EXPECT_EQ(loaded.processor.coreCount, collected.processor.coreCount);
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
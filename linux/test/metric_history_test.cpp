@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "core/metric_history.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+namespace {
+
+// Aligned to a minute so buckets of every resolution start here.
+constexpr int64_t kStartMs = 1700000040000;
+
+}  // namespace
+
+TEST(MetricHistory, RollsUpOneSecondBuckets) {
+  MetricHistory history;
+  history.Record(HistoryMetric::kCpuUsage, kStartMs, 10.0);
+  history.Record(HistoryMetric::kCpuUsage, kStartMs + 500, 30.0);
+  history.Record(HistoryMetric::kCpuUsage, kStartMs + 1200, 50.0);
+
+  std::vector<double> buckets = history.Query(
+      HistoryMetric::kCpuUsage, std::chrono::seconds(10),
+      HistoryResolution::kOneSecond, kStartMs + 2000);
+  ASSERT_EQ(buckets.size(), 2u * kHistoryStride);
+  EXPECT_EQ(buckets[0], kStartMs);
+  EXPECT_EQ(buckets[1], 10.0);
+  EXPECT_EQ(buckets[2], 30.0);
+  EXPECT_EQ(buckets[3], 20.0);
+  EXPECT_EQ(buckets[4], kStartMs + 1000);
+  EXPECT_EQ(buckets[5], 50.0);
+  EXPECT_EQ(buckets[6], 50.0);
+  EXPECT_EQ(buckets[7], 50.0);
+}
+
+TEST(MetricHistory, AggregatesCoarserResolutions) {
+  MetricHistory history;
+  for (int i = 0; i < 20; ++i) {
+    history.Record(HistoryMetric::kMemoryUsage, kStartMs + i * 1000, i);
+  }
+
+  std::vector<double> buckets = history.Query(
+      HistoryMetric::kMemoryUsage, std::chrono::minutes(1),
+      HistoryResolution::kTenSeconds, kStartMs + 20000);
+  ASSERT_EQ(buckets.size(), 2u * kHistoryStride);
+  EXPECT_EQ(buckets[1], 0.0);
+  EXPECT_EQ(buckets[2], 9.0);
+  EXPECT_DOUBLE_EQ(buckets[3], 4.5);
+  EXPECT_EQ(buckets[4], kStartMs + 10000);
+  EXPECT_EQ(buckets[5], 10.0);
+  EXPECT_EQ(buckets[6], 19.0);
+
+  buckets = history.Query(HistoryMetric::kMemoryUsage,
+                          std::chrono::minutes(10),
+                          HistoryResolution::kOneMinute, kStartMs + 20000);
+  ASSERT_EQ(buckets.size(), 1u * kHistoryStride);
+  EXPECT_DOUBLE_EQ(buckets[3], 9.5);
+}
+
+TEST(MetricHistory, LeavesOutOldBucketsAndOtherMetrics) {
+  MetricHistory history;
+  history.Record(HistoryMetric::kBatteryLevel, kStartMs, 80.0);
+  history.Record(HistoryMetric::kBatteryLevel, kStartMs + 30000, 79.0);
+
+  std::vector<double> buckets = history.Query(
+      HistoryMetric::kBatteryLevel, std::chrono::seconds(10),
+      HistoryResolution::kOneSecond, kStartMs + 31000);
+  ASSERT_EQ(buckets.size(), 1u * kHistoryStride);
+  EXPECT_EQ(buckets[0], kStartMs + 30000);
+
+  EXPECT_TRUE(history
+                  .Query(HistoryMetric::kAvailableStorage,
+                         std::chrono::minutes(1),
+                         HistoryResolution::kOneSecond, kStartMs + 31000)
+                  .empty());
+}
+
+// The 1 s ring covers 10 minutes, after which its slots are reused. A late
+// sample for a bucket whose slot was already reused is dropped there but
+// still kept at coarser resolutions.
+TEST(MetricHistory, DropsSamplesOlderThanTheRetention) {
+  MetricHistory history;
+  history.Record(HistoryMetric::kCpuUsage, kStartMs + 600000, 90.0);
+  history.Record(HistoryMetric::kCpuUsage, kStartMs, 10.0);
+
+  std::vector<double> buckets = history.Query(
+      HistoryMetric::kCpuUsage, std::chrono::seconds(1),
+      HistoryResolution::kOneSecond, kStartMs + 600000);
+  ASSERT_EQ(buckets.size(), 1u * kHistoryStride);
+  EXPECT_EQ(buckets[1], 90.0);
+  EXPECT_EQ(buckets[2], 90.0);
+
+  buckets = history.Query(HistoryMetric::kCpuUsage, std::chrono::hours(1),
+                          HistoryResolution::kTenSeconds, kStartMs + 600000);
+  ASSERT_EQ(buckets.size(), 2u * kHistoryStride);
+  EXPECT_EQ(buckets[0], kStartMs);
+  EXPECT_EQ(buckets[1], 10.0);
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "core/sampling_scheduler.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+namespace {
+
+using std::chrono::milliseconds;
+
+SamplingPolicy Policy(CollectorCost cost, int minMs, int maxMs) {
+  SamplingPolicy policy;
+  policy.cost = cost;
+  policy.minInterval = milliseconds(minMs);
+  policy.maxInterval = milliseconds(maxMs);
+  return policy;
+}
+
+}  // namespace
+
+TEST(SamplingScheduler, StartRunsEveryTaskOnTheCallingThread) {
+  SamplingScheduler scheduler;
+  std::thread::id caller = std::this_thread::get_id();
+  std::atomic<int> runs{0};
+  std::atomic<bool> onCaller{false};
+  scheduler.Add("a", Policy(CollectorCost::kCheap, 1000, 1000), [&] {
+    onCaller = std::this_thread::get_id() == caller;
+    ++runs;
+    return false;
+  });
+  scheduler.Add("b", Policy(CollectorCost::kExpensive, 1000, 1000), [&] {
+    ++runs;
+    return false;
+  });
+
+  scheduler.Start();
+  EXPECT_EQ(runs, 2);
+  EXPECT_TRUE(onCaller);
+  scheduler.Stop();
+}
+
+// A stable task doubles its interval up to the maximum; a changing one keeps
+// running at its minimum.
+TEST(SamplingScheduler, BacksOffWhileStable) {
+  SamplingScheduler scheduler;
+  std::atomic<int> stableRuns{0};
+  std::atomic<int> changingRuns{0};
+  scheduler.Add("stable", Policy(CollectorCost::kExpensive, 20, 160), [&] {
+    ++stableRuns;
+    return false;
+  });
+  scheduler.Add("changing", Policy(CollectorCost::kExpensive, 20, 160), [&] {
+    ++changingRuns;
+    return true;
+  });
+
+  scheduler.Start();
+  std::this_thread::sleep_for(milliseconds(500));
+  scheduler.Stop();
+
+  // Stable runs at 0, 20, 60, 140, 300 and 460 ms.
+  EXPECT_GE(changingRuns, 12);
+  EXPECT_LE(stableRuns, 8);
+  EXPECT_LT(stableRuns * 2, changingRuns);
+}
+
+TEST(SamplingScheduler, ReportsChangesToTheTickCallback) {
+  SamplingScheduler scheduler;
+  std::atomic<int> ticks{0};
+  std::atomic<int> changedTicks{0};
+  std::atomic<int> runs{0};
+  scheduler.Add("alternating", Policy(CollectorCost::kCheap, 20, 20), [&] {
+    return ++runs % 2 == 0;
+  });
+  scheduler.SetTickCallback([&](bool changed) {
+    ++ticks;
+    if (changed) ++changedTicks;
+  });
+
+  scheduler.Start();
+  std::this_thread::sleep_for(milliseconds(200));
+  scheduler.Stop();
+
+  EXPECT_EQ(ticks, runs);
+  EXPECT_EQ(changedTicks, runs / 2);
+}
+
+TEST(SamplingScheduler, PauseStopsSamplingUntilResumed) {
+  SamplingScheduler scheduler;
+  std::atomic<int> runs{0};
+  scheduler.Add("task", Policy(CollectorCost::kCheap, 10, 10), [&] {
+    ++runs;
+    return true;
+  });
+
+  scheduler.Start();
+  scheduler.Pause();
+  // A run already in progress may still finish.
+  std::this_thread::sleep_for(milliseconds(20));
+  int paused = runs;
+  std::this_thread::sleep_for(milliseconds(100));
+  EXPECT_EQ(runs, paused);
+
+  scheduler.Resume();
+  std::this_thread::sleep_for(milliseconds(50));
+  scheduler.Stop();
+  EXPECT_GT(runs, paused);
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+#include "core/snapshot.h"
+#include "core/snapshot_ring.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+namespace {
+
+std::string TestRingName(const char* suffix) {
+  return "/fdip_test." + std::to_string(getpid()) + "." + suffix;
+}
+
+DeviceSnapshot MakeSnapshot(int64_t timestampMs) {
+  DeviceSnapshot snapshot;
+  snapshot.timestampMs = timestampMs;
+  snapshot.memory.totalPhysicalMemory = 16 << 20;
+  snapshot.memory.availablePhysicalMemory = timestampMs;
+  snapshot.processor.coreCount = 8;
+  snapshot.battery.present = false;
+  return snapshot;
+}
+
+}  // namespace
+
+TEST(SnapshotRing, PublishesToReaders) {
+  std::string name = TestRingName("publish");
+  std::unique_ptr<SnapshotRing> writer = SnapshotRing::Create(name);
+  ASSERT_NE(writer, nullptr);
+  ASSERT_EQ(writer->name(), name);
+  EXPECT_EQ(writer->header()->writer_pid, static_cast<uint32_t>(getpid()));
+
+  std::unique_ptr<SnapshotRing> reader = SnapshotRing::Open(name);
+  ASSERT_NE(reader, nullptr);
+  fdip_sample sample;
+  EXPECT_FALSE(reader->ReadLatest(&sample));
+
+  writer->Publish(MakeSnapshot(1000));
+  writer->Publish(MakeSnapshot(2000));
+  ASSERT_TRUE(reader->ReadLatest(&sample));
+  EXPECT_EQ(sample.sequence, 2u);
+  EXPECT_EQ(sample.timestamp_ms, 2000);
+  EXPECT_EQ(sample.available_physical_memory, 2000);
+  EXPECT_EQ(sample.core_count, 8);
+  EXPECT_EQ(sample.battery_level, -1);
+
+  ASSERT_TRUE(ReadSample(reader->header(), 1, &sample));
+  EXPECT_EQ(sample.timestamp_ms, 1000);
+}
+
+TEST(SnapshotRing, OverwritesTheOldestSample) {
+  std::unique_ptr<SnapshotRing> ring =
+      SnapshotRing::Create(TestRingName("wrap"));
+  ASSERT_NE(ring, nullptr);
+  for (uint32_t i = 1; i <= FDIP_RING_CAPACITY + 1; ++i) {
+    ring->Publish(MakeSnapshot(i));
+  }
+
+  fdip_sample sample;
+  EXPECT_FALSE(ReadSample(ring->header(), 1, &sample));
+  ASSERT_TRUE(ReadSample(ring->header(), 2, &sample));
+  EXPECT_EQ(sample.timestamp_ms, 2);
+  ASSERT_TRUE(ring->ReadLatest(&sample));
+  EXPECT_EQ(sample.sequence, FDIP_RING_CAPACITY + 1);
+  EXPECT_FALSE(ReadSample(ring->header(), FDIP_RING_CAPACITY + 2, &sample));
+}
+
+TEST(SnapshotRing, NeverTakesOverALiveWriter) {
+  std::string name = TestRingName("live");
+  std::unique_ptr<SnapshotRing> first = SnapshotRing::Create(name);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(SnapshotRing::Create(name), nullptr);
+}
+
+TEST(SnapshotRing, ReplacesARingLeftByAnExitedWriter) {
+  std::string name = TestRingName("stale");
+  pid_t child = fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    // Exit without running destructors, like a crashed writer.
+    std::unique_ptr<SnapshotRing> ring = SnapshotRing::Create(name);
+    _exit(ring != nullptr ? 0 : 1);
+  }
+  int status = 0;
+  ASSERT_EQ(waitpid(child, &status, 0), child);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+  ASSERT_NE(SnapshotRing::Open(name), nullptr);
+
+  std::unique_ptr<SnapshotRing> ring = SnapshotRing::Create(name);
+  ASSERT_NE(ring, nullptr);
+  EXPECT_EQ(ring->name(), name);
+  EXPECT_EQ(ring->header()->writer_pid, static_cast<uint32_t>(getpid()));
+}
+
+TEST(SnapshotRing, UnlinkRemovesTheName) {
+  std::string name = TestRingName("unlink");
+  std::unique_ptr<SnapshotRing> ring = SnapshotRing::Create(name);
+  ASSERT_NE(ring, nullptr);
+  std::unique_ptr<SnapshotRing> reader = SnapshotRing::Open(name);
+  ASSERT_NE(reader, nullptr);
+
+  ring->Unlink();
+  EXPECT_TRUE(ring->name().empty());
+  EXPECT_EQ(SnapshotRing::Open(name), nullptr);
+
+  // Readers that already mapped the ring keep seeing new samples.
+  ring->Publish(MakeSnapshot(1000));
+  fdip_sample sample;
+  ASSERT_TRUE(reader->ReadLatest(&sample));
+  EXPECT_EQ(sample.timestamp_ms, 1000);
+
+  // The destructor also unlinks.
+  std::string other = TestRingName("destroy");
+  ASSERT_NE(SnapshotRing::Create(other), nullptr);
+  EXPECT_EQ(SnapshotRing::Open(other), nullptr);
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
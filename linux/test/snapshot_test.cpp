@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/metric_history.h"
+#include "core/snapshot.h"
+
+namespace flutter_device_info_plus {
+namespace test {
+
+namespace {
+
+int64_t NowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+size_t Buckets(const MetricHistory& history, HistoryMetric metric) {
+  return history
+             .Query(metric, std::chrono::minutes(1),
+                    HistoryResolution::kOneSecond, NowMs())
+             .size() /
+         kHistoryStride;
+}
+
+class SnapshotSamplerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Keep the hardware profile out of the user's cache.
+    char directory[] = "/tmp/fdip_snapshot_XXXXXX";
+    ASSERT_NE(mkdtemp(directory), nullptr);
+    directory_ = directory;
+    setenv("XDG_CACHE_HOME", directory, 1);
+  }
+
+  void TearDown() override {
+    system(("rm -rf '" + directory_ + "'").c_str());
+    unsetenv("XDG_CACHE_HOME");
+  }
+
+  std::string directory_;
+};
+
+}  // namespace
+
+TEST_F(SnapshotSamplerTest, RecordsHistoryFromTaskReadings) {
+  MetricHistory history;
+  SnapshotSampler sampler(std::chrono::seconds(1));
+  sampler.SetHistory(&history);
+  sampler.Start();
+  sampler.Stop();
+
+  // The first pass reads every collector once.
+  EXPECT_EQ(Buckets(history, HistoryMetric::kMemoryUsage), 1u);
+  EXPECT_EQ(Buckets(history, HistoryMetric::kAvailableMemory), 1u);
+  EXPECT_EQ(Buckets(history, HistoryMetric::kAvailableStorage), 1u);
+  // CPU usage needs two readings.
+  EXPECT_EQ(Buckets(history, HistoryMetric::kCpuUsage), 0u);
+}
+
+TEST_F(SnapshotSamplerTest, PublishesOnlyWhenTasksRun) {
+  MetricHistory history;
+  SnapshotSampler sampler(std::chrono::milliseconds(200));
+  sampler.SetHistory(&history);
+  std::vector<uint64_t> sequences;
+  sampler.SetListener([&sequences](const DeviceSnapshot& snapshot) {
+    sequences.push_back(snapshot.sequence);
+  });
+  sampler.Start();
+  sampler.Pause();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1300));
+  size_t paused = sequences.size();
+  sampler.Stop();
+
+  // Only the first pass published; recording history never wakes a paused
+  // sampler.
+  EXPECT_EQ(paused, 1u);
+  EXPECT_EQ(sampler.Latest()->sequence, 1u);
+}
+
+}  // namespace test
+}  // namespace flutter_device_info_plus
@@ -1,3 +1,9 @@
+import 'dart:typed_data';
+
+import 'package:flutter/foundation.dart'
+    show TargetPlatform, debugDefaultTargetPlatformOverride;
+import 'package:flutter/services.dart'
+    show MethodCall, MethodChannel, PlatformException;
 import 'package:flutter_device_info_plus/flutter_device_info_plus.dart';
 import 'package:flutter_test/flutter_test.dart';
 
@@ -78,6 +84,269 @@ void main() {
       });
     });
 
+    group('Linux-only methods', () {
+      final linuxOnly = <String, Object? Function(FlutterDeviceInfoPlus)>{
+        'startSharedSampling': (final d) => d.startSharedSampling(),
+        'stopSharedSampling': (final d) => d.stopSharedSampling(),
+        'getMonitors': (final d) => d.getMonitors(),
+        'watchMonitors': (final d) => d.watchMonitors(),
+        'getResourceLimits': (final d) => d.getResourceLimits(),
+        'getCpuTopology': (final d) => d.getCpuTopology(),
+        'setFreshnessWindow': (final d) => d.setFreshnessWindow(Duration.zero),
+        'getPluginStats': (final d) => d.getPluginStats(),
+        'getHistory': (final d) => d.getHistory(HistoryMetric.cpuUsage),
+        'getGpus': (final d) => d.getGpus(),
+      };
+
+      for (final MapEntry(key: name, value: call) in linuxOnly.entries) {
+        test('$name should be unsupported outside of Linux', () async {
+          await expectLater(
+            Future<Object?>.sync(() => call(deviceInfo)),
+            throwsA(isA<UnsupportedFeatureException>()),
+          );
+        });
+      }
+
+      test('readLatestSample should return null outside of Linux', () {
+        expect(deviceInfo.readLatestSample(), isNull);
+      });
+    });
+
+    group('on Linux', () {
+      const channel = MethodChannel('flutter_device_info_plus');
+      final calls = <MethodCall>[];
+
+      void mockChannel(final Object? Function(MethodCall call) handler) {
+        TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+            .setMockMethodCallHandler(channel, (final call) async {
+              calls.add(call);
+              return handler(call);
+            });
+      }
+
+      setUp(() {
+        debugDefaultTargetPlatformOverride = TargetPlatform.linux;
+        calls.clear();
+      });
+
+      tearDown(() {
+        debugDefaultTargetPlatformOverride = null;
+        TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+            .setMockMethodCallHandler(channel, null);
+      });
+
+      test('startSharedSampling should return null when anonymous', () async {
+        var ringName = '/flutter_device_info_plus.1000.4242';
+        mockChannel((final call) => {'ringName': ringName});
+
+        expect(
+          await deviceInfo.startSharedSampling(
+            interval: const Duration(milliseconds: 250),
+          ),
+          ringName,
+        );
+        expect(calls.single.arguments, {'intervalMs': 250});
+
+        ringName = '';
+        expect(await deviceInfo.startSharedSampling(), isNull);
+      });
+
+      test('should wrap platform errors in DeviceInfoException', () async {
+        mockChannel(
+          (final call) => throw PlatformException(code: 'UNAVAILABLE'),
+        );
+
+        await expectLater(
+          deviceInfo.startSharedSampling(),
+          throwsA(isA<DeviceInfoException>()),
+        );
+        await expectLater(
+          deviceInfo.stopSharedSampling(),
+          throwsA(isA<DeviceInfoException>()),
+        );
+      });
+
+      test('getResourceLimits should map unlimited values to null', () async {
+        mockChannel(
+          (final call) => {
+            'cgroupVersion': 2,
+            'cgroupPath': '/user.slice/app.scope',
+            'onlineCpuCount': 16,
+            'allowedCpus': [0, 1, 2, 3],
+            'cpusetCpus': [0, 1, 2, 3],
+            'cpuQuota': 1.5,
+            'effectiveCpuCount': 2,
+            'memoryLimit': -1,
+            'effectiveMemory': 34359738368,
+            'ioLimits': [
+              {
+                'device': '8:0',
+                'readBps': -1,
+                'writeBps': 1048576,
+                'readIops': -1,
+                'writeIops': 100,
+              },
+            ],
+          },
+        );
+
+        final limits = await deviceInfo.getResourceLimits();
+
+        expect(calls.single.arguments, {'refresh': false});
+        expect(limits.cgroupVersion, 2);
+        expect(limits.cpuQuota, 1.5);
+        expect(limits.effectiveCpuCount, 2);
+        expect(limits.memoryLimit, isNull);
+        expect(
+          limits.ioLimits.single,
+          const IoLimit(
+            device: '8:0',
+            writeBytesPerSecond: 1048576,
+            writeOperationsPerSecond: 100,
+          ),
+        );
+      });
+
+      test('getCpuTopology should parse the NUMA nodes', () async {
+        mockChannel(
+          (final call) => {
+            'onlineCpus': [0, 1, 2, 3],
+            'allowedCpus': [0, 1],
+            'isolatedCpus': [3],
+            'nodes': [
+              {
+                'id': 0,
+                'cpus': [0, 1],
+                'totalMemory': 8589934592,
+                'freeMemory': 4294967296,
+                'distances': [10, 21],
+              },
+              {
+                'id': 1,
+                'cpus': [2, 3],
+                'distances': [21, 10],
+              },
+            ],
+          },
+        );
+
+        final topology = await deviceInfo.getCpuTopology();
+
+        expect(calls.single.method, 'getCpuTopology');
+        expect(topology.allowedCpus, [0, 1]);
+        expect(topology.isolatedCpus, [3]);
+        expect(topology.nodes, hasLength(2));
+        expect(topology.nodes[0].totalMemory, 8589934592);
+        expect(topology.nodes[1].cpus, [2, 3]);
+        expect(topology.nodes[1].distances, [21, 10]);
+      });
+
+      test('setFreshnessWindow should reject negative windows', () async {
+        mockChannel((final call) => null);
+
+        await deviceInfo.setFreshnessWindow(const Duration(milliseconds: 100));
+        expect(calls.single.method, 'setFreshnessWindow');
+        expect(calls.single.arguments, {'windowMs': 100});
+
+        await expectLater(
+          deviceInfo.setFreshnessWindow(const Duration(milliseconds: -1)),
+          throwsArgumentError,
+        );
+        expect(calls, hasLength(1));
+      });
+
+      test('getPluginStats should include joins in the hit ratio', () async {
+        mockChannel(
+          (final call) => {
+            'collectors': {
+              'memory': {'calls': 4, 'totalNs': 8000, 'maxNs': 3000},
+            },
+            'caches': {
+              'queryResult': {'hits': 6, 'misses': 2, 'joins': 2},
+            },
+            'fileReads': 12,
+            'bytesRead': 4096,
+          },
+        );
+
+        final stats = await deviceInfo.getPluginStats();
+
+        expect(stats.collectors['memory']!.calls, 4);
+        expect(
+          stats.collectors['memory']!.maxTime,
+          const Duration(microseconds: 3),
+        );
+        expect(stats.caches['queryResult']!.joins, 2);
+        expect(stats.caches['queryResult']!.hitRatio, 0.6);
+        expect(stats.bytesRead, 4096);
+      });
+
+      test('getHistory should send the range and resolution', () async {
+        mockChannel(
+          (final call) =>
+              Float64List.fromList([1000, 10, 30, 20, 2000, 50, 50, 50]),
+        );
+
+        final history = await deviceInfo.getHistory(
+          HistoryMetric.memoryUsage,
+          range: const Duration(minutes: 5),
+          resolution: HistoryResolution.tenSeconds,
+        );
+
+        expect(calls.single.arguments, {
+          'metric': 'memoryUsage',
+          'rangeMs': 300000,
+          'resolutionMs': 10000,
+        });
+        expect(history.bucketCount, 2);
+        expect(history.startMsAt(1), 2000);
+        expect(history.averageAt(0), 20);
+      });
+
+      test('getGpus should pass refresh and parse every device', () async {
+        mockChannel(
+          (final call) => [
+            {
+              'card': 'card0',
+              'driver': 'amdgpu',
+              'pciVendorId': 0x1002,
+              'pciDeviceId': 0x73BF,
+              'pciSlot': '0000:03:00.0',
+              'isBootVga': true,
+              'vramTotal': 17163091968,
+              'currentClockMhz': 1800,
+              'maxClockMhz': 2575,
+              'renderNode': '/dev/dri/renderD128',
+            },
+            {'card': 'card1', 'driver': 'simpledrm'},
+          ],
+        );
+
+        final gpus = await deviceInfo.getGpus(refresh: true);
+
+        expect(calls.single.method, 'getGpus');
+        expect(calls.single.arguments, {'refresh': true});
+        expect(gpus, hasLength(2));
+        expect(gpus[0].driver, 'amdgpu');
+        expect(gpus[0].pciVendorId, 0x1002);
+        expect(gpus[0].vramTotal, 17163091968);
+        expect(gpus[0].renderNode, '/dev/dri/renderD128');
+        expect(gpus[1].card, 'card1');
+        expect(gpus[1].renderNode, isEmpty);
+      });
+    });
+
+    group('synchronous queries', () {
+      test('should return null without the native library', () {
+        // Unit tests don't load the plugin's shared library, so every
+        // synchronous query takes the fallback path.
+        expect(deviceInfo.getCoreCountSync(), isNull);
+        expect(deviceInfo.getTotalPhysicalMemorySync(), isNull);
+        expect(deviceInfo.getAvailablePhysicalMemorySync(), isNull);
+        expect(deviceInfo.getCpuUsagePercentageSync(), isNull);
+      });
+    });
+
     group('getCurrentPlatform', () {
       test('should return current platform name', () {
         final platform = deviceInfo.getCurrentPlatform();
@@ -444,6 +713,182 @@ void main() {
     });
   });
 
+  group('MonitorInfo', () {
+    test('should parse platform maps and derive physical values', () {
+      final monitor = MonitorInfo.fromMap(const {
+        'name': 'eDP-1',
+        'manufacturer': 'BOE',
+        'model': 'NE135FBM',
+        'width': 1128,
+        'height': 752,
+        'scaleFactor': 2,
+        'refreshRate': 59.998,
+        'widthMm': 285,
+        'heightMm': 190,
+        'isPrimary': true,
+        'isHdr': true,
+        'maxLuminance': 400.0,
+        'bitDepth': 10,
+      });
+
+      expect(monitor.physicalWidth, 2256);
+      expect(monitor.physicalHeight, 1504);
+      expect(monitor.diagonalInches, closeTo(13.5, 0.1));
+      expect(monitor.x, 0);
+      expect(monitor.isHdr, true);
+      expect(monitor.copyWith(), equals(monitor));
+      expect(monitor.copyWith(isPrimary: false), isNot(equals(monitor)));
+    });
+  });
+
+  group('CpuTopology', () {
+    test('should map CPUs to NUMA nodes', () {
+      final topology = CpuTopology.fromMap(const {
+        'onlineCpus': [0, 1, 2, 3],
+        'allowedCpus': [1, 2, 3],
+        'isolatedCpus': [3],
+        'nodes': [
+          {
+            'id': 0,
+            'cpus': [0, 1],
+            'totalMemory': 8589934592,
+            'freeMemory': 4294967296,
+            'distances': [10, 21],
+          },
+          {
+            'id': 1,
+            'cpus': [2, 3],
+            'totalMemory': 8589934592,
+            'freeMemory': 4294967296,
+            'distances': [21, 10],
+          },
+        ],
+      });
+
+      expect(topology.isNuma, true);
+      expect(topology.nodeOf(2)?.id, 1);
+      expect(topology.nodeOf(7), isNull);
+      expect(topology.allowedCpusOn(topology.nodes.first), [1]);
+      expect(CpuTopology.fromMap(const {}).isNuma, false);
+    });
+  });
+
+  group('GpuInfo', () {
+    test('should parse DRM devices', () {
+      final gpu = GpuInfo.fromMap(const {
+        'card': 'card0',
+        'driver': 'amdgpu',
+        'pciVendorId': 0x1002,
+        'pciDeviceId': 0x73bf,
+        'pciSlot': '0000:03:00.0',
+        'isBootVga': true,
+        'vramTotal': 17163091968,
+        'currentClockMhz': 500,
+        'maxClockMhz': 2615,
+        'renderNode': '/dev/dri/renderD128',
+      });
+
+      expect(gpu.pciVendorId, 0x1002);
+      expect(gpu.isRenderCapable, true);
+      expect(gpu.vramTotal, 17163091968);
+      expect(
+        GpuInfo.fromMap(const {'driver': 'simpledrm'}).isRenderCapable,
+        false,
+      );
+    });
+  });
+
+  group('MetricHistory', () {
+    test('should read packed buckets', () {
+      final history = MetricHistory(
+        Float64List.fromList([1000, 10, 30, 20, 2000, 5, 5, 5]),
+      );
+
+      expect(history.bucketCount, 2);
+      expect(history.startMsAt(1), 2000);
+      expect(history.minAt(0), 10);
+      expect(history.maxAt(0), 30);
+      expect(history.averageAt(0), 20);
+      expect(HistoryResolution.tenSeconds.retention, const Duration(hours: 1));
+    });
+  });
+
+  group('PluginStats', () {
+    test('should parse collector timings and cache counters', () {
+      final stats = PluginStats.fromMap(const {
+        'collectors': {
+          'memory': {'calls': 4, 'totalNs': 80000, 'maxNs': 50000},
+        },
+        'caches': {
+          'queryResult': {'hits': 3, 'misses': 1},
+        },
+        'fileReads': 12,
+        'bytesRead': 4096,
+      });
+
+      final memory = stats.collectors['memory']!;
+      expect(memory.averageTime, const Duration(microseconds: 20));
+      expect(memory.maxTime, const Duration(microseconds: 50));
+      expect(stats.caches['queryResult']!.hitRatio, 0.75);
+      expect(const CacheStats(hits: 0, misses: 0).hitRatio, 0);
+      expect(PluginStats.fromMap(const {}).collectors, isEmpty);
+    });
+  });
+
+  group('ResourceLimits', () {
+    test('should map unlimited values to null', () {
+      final limits = ResourceLimits.fromMap(const {
+        'cgroupVersion': 2,
+        'cgroupPath': '/user.slice',
+        'onlineCpuCount': 8,
+        'allowedCpus': [0, 1, 2, 3, 4, 5, 6, 7],
+        'cpusetCpus': [0, 1, 2, 3, 4, 5, 6, 7],
+        'cpuQuota': 1.5,
+        'effectiveCpuCount': 2,
+        'memoryLimit': -1,
+        'effectiveMemory': 17179869184,
+        'ioLimits': [
+          {
+            'device': '8:0',
+            'readBps': -1,
+            'writeBps': 1048576,
+            'readIops': -1,
+            'writeIops': -1,
+          },
+        ],
+      });
+
+      expect(limits.cpuQuota, 1.5);
+      expect(limits.memoryLimit, isNull);
+      expect(limits.ioLimits.single.readBytesPerSecond, isNull);
+      expect(limits.ioLimits.single.writeBytesPerSecond, 1048576);
+      expect(limits.isConstrained, true);
+      expect(ResourceLimits.fromMap(const {'cpuQuota': 0.0}).cpuQuota, isNull);
+    });
+  });
+
+  group('DeviceSample', () {
+    test('should calculate memory usage and compare by value', () {
+      final sample = DeviceSample(
+        sequence: 1,
+        timestamp: DateTime.fromMillisecondsSinceEpoch(1000),
+        totalPhysicalMemory: 8589934592,
+        availablePhysicalMemory: 2147483648,
+        totalStorageSpace: 1099511627776,
+        availableStorageSpace: 549755813888,
+        coreCount: 8,
+        maxFrequency: 2400,
+        isConnected: true,
+      );
+
+      expect(sample.memoryUsagePercentage, closeTo(75, 0.01));
+      expect(sample.batteryLevel, isNull);
+      expect(sample.copyWith(), equals(sample));
+      expect(sample.copyWith(sequence: 2), isNot(equals(sample)));
+      expect(sample.copyWith().hashCode, equals(sample.hashCode));
+    });
+  });
+
   group('Exceptions', () {
     test('DeviceInfoException should format correctly', () {
       const exception = DeviceInfoException('Test error message');